@@ -0,0 +1,683 @@
+/**
+ * @file rl_locomotion_ability.cpp
+ * @brief Ability running the bundled RL locomotion policies in-process.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "limxsdk/ability/base_ability.h"
+#include "limxsdk/ability/diagnostics.h"
+#include "limxsdk/ability/imu_preintegrator.h"
+#include "limxsdk/ability/rate.h"
+#include "limxsdk/ability/seqlock.h"
+#include "limxsdk/ability/yaml_config_parser.h"
+#include "limxsdk/model/leg_dynamics.h"
+#include "limxsdk/rl/joint_safety.h"
+#include "limxsdk/rl/locomotion_controller.h"
+#include "limxsdk/rl/policy_config.h"
+#include "limxsdk/rl/policy_set.h"
+#include "limxsdk/rl/quantization.h"
+#include "limxsdk/rl/session_factory.h"
+#include "limxsdk/rl/shadow_evaluator.h"
+
+namespace
+{
+  // Joint state snapshot that can be handed from the SDK callback through a SeqLock
+  struct JointSample
+  {
+    enum { MAX_JOINTS = 32 };
+    uint64_t stamp;
+    uint32_t count;
+    float q[MAX_JOINTS];
+    float dq[MAX_JOINTS];
+  };
+
+  std::string configString(const YAML::Node& config, const char* key, const char* env, const std::string& fallback)
+  {
+    if (config[key] && !config[key].as<std::string>().empty())
+    {
+      return config[key].as<std::string>();
+    }
+    const char* value = env ? std::getenv(env) : nullptr;
+    return value && *value ? std::string(value) : fallback;
+  }
+} // namespace
+
+/**
+ * @brief Runs stand-up, then the decimated observation -> encoder -> policy
+ *        step and the PD command output of the Python RL controllers.
+ *
+ * Several policies can be preloaded; L1 + A and L1 + B switch to the next
+ * and previous one while walking, at a decimation boundary and without
+ * loading anything.
+ *
+ * Configuration (all optional):
+ *   model_dir:           Model root, relative to the ability etc path. Default "model".
+ *   robot_type:          e.g. PF_TRON1A. Defaults to $ROBOT_TYPE.
+ *   rl_type:             isaacgym or isaaclab. Defaults to $RL_TYPE, then isaacgym.
+ *   policies:            List of {robot_type, rl_type} entries to preload instead, the first active
+ *                        at start; missing fields default as above. All must drive the same joints
+ *                        at the same loop frequency; decimation and joint limits follow the active one.
+ *   crossfade_steps:     Policy steps over which a switch blends the joint commands, 0 to cut over.
+ *   shadow_policies:     {robot_type, rl_type} candidates evaluated in shadow next to the first
+ *                        policy: they see its observations, never drive the joints, and their
+ *                        action deltas are printed with the latency report.
+ *   backend:             Inference backend, "native" or "onnxruntime". Default "native".
+ *   precision:           Native weight precision fp32, fp16 or int8. Default fp32.
+ *   max_action_error:    Largest calibrated fp16/int8 action error accepted. Default 0.05.
+ *   encoder_cpu:         CPU for the encoder thread of models with inference.pipelined_encoder,
+ *                        overriding params.yaml. Default -1 (params.yaml, else unpinned).
+ *   warmup_iterations:   Synthetic inferences per network in on_init, 0 to skip. Default 200.
+ *   imu_source:          "raw" feeds the device quaternion and gyro to the policy, "estimator" the
+ *                        framework's full-rate filtered orientation and bias-corrected gyro. Default raw.
+ *   imu_averaging:       Feed the policy the mean gyro and acc over all IMU samples of the last policy
+ *                        period instead of the newest sample. Default false.
+ *   gravity_compensation: While walking, add the torque holding the legs' own links against gravity to
+ *                        the feed-forward torque. The leg type follows the policy's joints. Default false.
+ *   leg_geometry:        URDF origins and links replacing the nominal leg for gravity_compensation, as in
+ *                        the base_velocity_estimator section of the framework configuration.
+ *   joint_safety:        Clamp every command to the params.yaml joint_limits and torque limits right
+ *                        before it is published; counters are printed with the latency report. Default true.
+ *   start_immediately:   Skip waiting for L1 + Y, as the Python controllers do in simulation.
+ *   report_interval:     Seconds between latency reports, 0 to report only on stop. Default 10.
+ */
+class RLLocomotionAbility : public limxsdk::ability::BaseAbility
+{
+public:
+  bool on_init(const YAML::Node& config) override
+  {
+    std::string model_dir = configString(config, "model_dir", nullptr, "model");
+    if (!model_dir.empty() && model_dir[0] != '/')
+    {
+      model_dir = limxsdk::ability::path::etc() + "/" + model_dir;
+    }
+    const std::string robot_type = configString(config, "robot_type", "ROBOT_TYPE", "");
+    const std::string rl_type = configString(config, "rl_type", "RL_TYPE", "isaacgym");
+    backend_ = configString(config, "backend", nullptr, "native");
+    precision_name_ = configString(config, "precision", nullptr, "fp32");
+    max_action_error_ = config["max_action_error"] ? config["max_action_error"].as<double>() : 0.05;
+    encoder_cpu_ = config["encoder_cpu"] ? config["encoder_cpu"].as<int>() : -1;
+    warmup_iterations_ = config["warmup_iterations"] ? config["warmup_iterations"].as<int>() : 200;
+    const std::string imu_source = configString(config, "imu_source", nullptr, "raw");
+    start_immediately_ = config["start_immediately"] ? config["start_immediately"].as<bool>() : false;
+    report_interval_ = config["report_interval"] ? config["report_interval"].as<double>() : 10.0;
+
+    if (imu_source != "raw" && imu_source != "estimator")
+    {
+      std::cerr << "RL locomotion: unknown imu_source '" << imu_source << "'" << std::endl;
+      return false;
+    }
+    use_imu_estimator_ = imu_source == "estimator";
+    imu_averaging_ = config["imu_averaging"] ? config["imu_averaging"].as<bool>() : false;
+    joint_safety_enabled_ = config["joint_safety"] ? config["joint_safety"].as<bool>() : true;
+    gravity_compensation_ = config["gravity_compensation"] ? config["gravity_compensation"].as<bool>() : false;
+    if (!limxsdk::rl::parsePrecision(precision_name_, precision_))
+    {
+      std::cerr << "RL locomotion: unknown precision '" << precision_name_ << "'" << std::endl;
+      return false;
+    }
+    if (precision_ != limxsdk::rl::Precision::FP32)
+    {
+      if (backend_.compare(0, 6, "native") != 0)
+      {
+        std::cerr << "RL locomotion: precision " << precision_name_ << " needs the native backend" << std::endl;
+        return false;
+      }
+      backend_ += ":" + precision_name_;
+    }
+
+    if (config["policies"])
+    {
+      for (const auto& entry : config["policies"])
+      {
+        if (!loadPolicy(model_dir, configString(entry, "robot_type", nullptr, robot_type),
+                        configString(entry, "rl_type", nullptr, rl_type)))
+        {
+          return false;
+        }
+      }
+    }
+    else if (!loadPolicy(model_dir, robot_type, rl_type))
+    {
+      return false;
+    }
+    if (policies_.size() == 0)
+    {
+      std::cerr << "RL locomotion: no policies configured" << std::endl;
+      return false;
+    }
+    policies_.setCrossfade(config["crossfade_steps"] ? config["crossfade_steps"].as<int>() : 0);
+    if (config["shadow_policies"] && !loadShadow(model_dir, config["shadow_policies"], rl_type))
+    {
+      return false;
+    }
+    policies_.active().prepareCommand(cmd_);
+    const limxsdk::rl::PolicyConfig& active = policies_.active().config();
+    joint_safety_.configure(active);
+    applyPolicySettings();
+    if (gravity_compensation_ && !configureLegs(active, config["leg_geometry"]))
+    {
+      return false;
+    }
+
+    limxsdk::ImuData identity;
+    identity.stamp = 0;
+    identity.quat[0] = 1.0f;
+    imu_.store(identity);
+    return true;
+  }
+
+  void on_start() override
+  {
+    // SDK subscriptions cannot be removed, so they are made once and outlive restarts
+    if (!subscribed_)
+    {
+      subscribe();
+      subscribed_ = true;
+    }
+    diag_latency_ = make_diagnostic("latency", 1, limxsdk::DiagnosticValue::WARN, "", 5.0);
+    diag_inference_ = make_diagnostic("inference", -1, limxsdk::DiagnosticValue::ERROR, "Inference failed", 1.0);
+    controller_running_ = start_immediately_;
+  }
+
+  void on_main() override
+  {
+    while (running_)
+    {
+      if (!controller_running_)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        continue;
+      }
+      control();
+    }
+  }
+
+  void on_stop() override
+  {
+    controller_running_ = false;
+  }
+
+private:
+  // Loads, checks and warms up one policy and adds it to policies_
+  bool loadPolicy(const std::string& model_dir, const std::string& robot_type, const std::string& rl_type)
+  {
+    const std::string name = robot_type + "/" + rl_type;
+    limxsdk::rl::PolicyConfig policy_config;
+    if (robot_type.empty() || !policy_config.load(model_dir, robot_type, rl_type))
+    {
+      std::cerr << "RL locomotion: cannot load robot type '" << robot_type << "' from " << model_dir << std::endl;
+      return false;
+    }
+    // Quantized weights only run if calibration showed them close enough to fp32
+    if (!limxsdk::rl::quantizedDeploymentAllowed(policy_config, precision_, max_action_error_))
+    {
+      std::cerr << "RL locomotion: refusing to deploy " << precision_name_ << " weights for " << name << std::endl;
+      return false;
+    }
+    if (encoder_cpu_ >= 0)
+    {
+      policy_config.encoderCpu = encoder_cpu_;
+    }
+    if (policy_config.jointCount() > JointSample::MAX_JOINTS)
+    {
+      std::cerr << "RL locomotion: too many joints" << std::endl;
+      return false;
+    }
+    if (!policies_.add(name, policy_config,
+                       limxsdk::rl::loadInferenceSession(backend_, policy_config.encoderPath),
+                       limxsdk::rl::loadInferenceSession(backend_, policy_config.policyPath)))
+    {
+      return false;
+    }
+    limxsdk::rl::LocomotionController& controller = policies_.controller(policies_.size() - 1);
+
+    // Pay for lazy setup and cold caches here rather than in the first walk step
+    if (warmup_iterations_ > 0)
+    {
+      limxsdk::rl::WarmupReport encoder;
+      limxsdk::rl::WarmupReport policy;
+      if (!controller.warmUp(warmup_iterations_, encoder, policy))
+      {
+        return false;
+      }
+      std::printf("RL locomotion warm-up [us]: encoder first %.1f steady %.1f | policy first %.1f steady %.1f "
+                  "(%d runs)\n",
+                  encoder.firstNs / 1e3, encoder.steadyMeanNs / 1e3, policy.firstNs / 1e3, policy.steadyMeanNs / 1e3,
+                  warmup_iterations_);
+    }
+
+    std::cout << "RL locomotion: policy " << policies_.size() - 1 << " " << name << " (" << backend_ << ") at "
+              << policy_config.loopFrequency << " Hz, decimation " << policy_config.decimation << std::endl;
+    if (controller.pipelined())
+    {
+      std::cout << "RL locomotion: pipelined encoder on CPU " << policy_config.encoderCpu << ", latent "
+                << controller.latentAge() * 1e3 << " ms old" << std::endl;
+    }
+    return true;
+  }
+
+  bool loadShadow(const std::string& model_dir, const YAML::Node& entries, const std::string& rl_type)
+  {
+    const limxsdk::rl::PolicyConfig& live = policies_.controller(0).config();
+    if (!shadow_.init(live))
+    {
+      return false;
+    }
+    for (const auto& entry : entries)
+    {
+      const std::string robot_type = configString(entry, "robot_type", nullptr, live.robotType);
+      const std::string candidate_rl_type = configString(entry, "rl_type", nullptr, rl_type);
+      limxsdk::rl::PolicyConfig candidate;
+      if (!candidate.load(model_dir, robot_type, candidate_rl_type) ||
+          !shadow_.addCandidate(robot_type + "/" + candidate_rl_type, candidate))
+      {
+        std::cerr << "RL locomotion: cannot shadow " << robot_type << "/" << candidate_rl_type << std::endl;
+        return false;
+      }
+    }
+    std::cout << "RL locomotion: " << shadow_.size() << " shadow policies next to " << policies_.name(0) << std::endl;
+    return true;
+  }
+
+  // Leg type from the policy's joints: ankles make a sole foot, wheels a wheel foot
+  bool configureLegs(const limxsdk::rl::PolicyConfig& policy, const YAML::Node& geometry)
+  {
+    limxsdk::model::LegType type = limxsdk::model::LegType::POINTFOOT;
+    for (const limxsdk::rl::JointKind kind : policy.jointKinds)
+    {
+      if (kind == limxsdk::rl::JointKind::ANKLE)
+      {
+        type = limxsdk::model::LegType::SOLEFOOT;
+      }
+      else if (kind == limxsdk::rl::JointKind::WHEEL)
+      {
+        type = limxsdk::model::LegType::WHEELFOOT;
+      }
+    }
+    leg_geometry_ = limxsdk::model::LegGeometry::nominal(type);
+    if (policy.jointCount() != 2 * leg_geometry_.joints)
+    {
+      std::cerr << "RL locomotion: gravity_compensation needs two legs of " << leg_geometry_.joints
+                << " joints, the policy drives " << policy.jointCount() << std::endl;
+      return false;
+    }
+    if (geometry)
+    {
+      limxsdk::ability::YamlConfigParser::parseLegGeometry(geometry, leg_geometry_);
+    }
+    return true;
+  }
+
+  // Takes the IMU window and joint limits of the active policy, which may differ in decimation and limits
+  void applyPolicySettings()
+  {
+    const limxsdk::rl::PolicyConfig& active = policies_.active().config();
+    imu_window_.setWindow(static_cast<double>(active.decimation) / active.loopFrequency);
+    joint_safety_.setLimits(active);
+    applied_policy_ = policies_.activeIndex();
+  }
+
+  // Adds the torque holding the legs against gravity, tilted into the base frame by the IMU, to the feed-forward
+  void applyGravityCompensation(const JointSample& state, const limxsdk::ImuData& imu)
+  {
+    const float w = imu.quat[0], x = imu.quat[1], y = imu.quat[2], z = imu.quat[3];
+    const float gravity[3] = {-9.81f * 2.0f * (x * z - w * y), -9.81f * 2.0f * (y * z + w * x),
+                              -9.81f * (1.0f - 2.0f * (x * x + y * y))};
+    switch (leg_geometry_.type)
+    {
+    case limxsdk::model::LegType::POINTFOOT:
+      gravityTorque<limxsdk::model::LegType::POINTFOOT>(state.q, gravity);
+      break;
+    case limxsdk::model::LegType::SOLEFOOT:
+      gravityTorque<limxsdk::model::LegType::SOLEFOOT>(state.q, gravity);
+      break;
+    case limxsdk::model::LegType::WHEELFOOT:
+      gravityTorque<limxsdk::model::LegType::WHEELFOOT>(state.q, gravity);
+      break;
+    }
+  }
+
+  template <limxsdk::model::LegType TYPE>
+  void gravityTorque(const float* q, const float gravity[3])
+  {
+    typedef limxsdk::model::LegDynamics<TYPE> Dynamics;
+    const Dynamics dynamics(leg_geometry_);
+    float tau[Dynamics::LEGS * Dynamics::JOINTS];
+    dynamics.gravity(q, gravity, tau);
+    for (int j = 0; j < Dynamics::LEGS * Dynamics::JOINTS; ++j)
+    {
+      cmd_.tau[j] += tau[j];
+    }
+  }
+
+  // Replaces the newest gyro and acc with their mean over the last policy period
+  void applyImuWindow(limxsdk::ImuData& imu) const
+  {
+    const limxsdk::ability::ImuWindow window = imu_window_.load();
+    if (window.samples == 0)
+    {
+      return;
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      imu.gyro[i] = window.gyro[i];
+      imu.acc[i] = window.acc[i];
+    }
+  }
+
+  // Takes the estimator orientation and removes its gyro bias once it has seen a sample
+  void applyImuEstimate(limxsdk::ImuData& imu) const
+  {
+    const limxsdk::ability::ImuEstimate estimate = get_imu_estimate();
+    if (estimate.samples == 0)
+    {
+      return;
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+      imu.quat[i] = estimate.quat[i];
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      imu.gyro[i] -= estimate.gyroBias[i];
+    }
+  }
+
+  void subscribe()
+  {
+    limxsdk::ApiBase* robot = get_robot_instance();
+    robot->subscribeImuData([this](const limxsdk::ImuDataConstPtr& msg) {
+      imu_.store(*msg);
+      if (imu_averaging_)
+      {
+        imu_window_.push(*msg);
+      }
+    });
+    robot->subscribeRobotState([this](const limxsdk::RobotStateConstPtr& msg) {
+      JointSample sample;
+      sample.stamp = msg->stamp;
+      sample.count = static_cast<uint32_t>(std::min<size_t>(msg->q.size(), JointSample::MAX_JOINTS));
+      for (uint32_t i = 0; i < sample.count; ++i)
+      {
+        sample.q[i] = msg->q[i];
+        sample.dq[i] = i < msg->dq.size() ? msg->dq[i] : 0.0f;
+      }
+      state_.store(sample);
+    });
+    robot->subscribeSensorJoy([this](const limxsdk::SensorJoyConstPtr& msg) {
+      onJoystick(*msg);
+    });
+    diagnostics_.subscribe("calibration", [this](uint32_t, const limxsdk::DiagnosticValue& msg) {
+      std::cout << "Calibration state: " << msg.code << std::endl;
+      calibration_state_ = msg.code;
+    });
+    diagnostics_.attach(robot);
+  }
+
+  void onJoystick(const limxsdk::SensorJoy& joy)
+  {
+    if (joy.buttons.size() > 4)
+    {
+      // L1 + Y starts the controller once calibrated, L1 + X stops it
+      if (!controller_running_ && calibration_state_ == 0 && joy.buttons[4] == 1 && joy.buttons[3] == 1)
+      {
+        std::cout << "L1 + Y: start_controller..." << std::endl;
+        controller_running_ = true;
+      }
+      if (controller_running_ && joy.buttons[4] == 1 && joy.buttons[2] == 1)
+      {
+        std::cout << "L1 + X: stop_controller..." << std::endl;
+        controller_running_ = false;
+      }
+      // L1 + A / L1 + B select the next / previous preloaded policy, once per press
+      const bool next = joy.buttons[4] == 1 && joy.buttons[0] == 1;
+      const bool previous = joy.buttons[4] == 1 && joy.buttons[1] == 1;
+      if ((next || previous) && !switch_held_ && policies_.size() > 1)
+      {
+        const int count = static_cast<int>(policies_.size());
+        const int current = requested_policy_ >= 0 ? requested_policy_.load() : selected_policy_.load();
+        requested_policy_ = (current + (next ? 1 : count - 1)) % count;
+      }
+      switch_held_ = next || previous;
+    }
+    if (joy.axes.size() > 2)
+    {
+      command_x_ = clamp(joy.axes[1]) * 0.5f;
+      command_y_ = clamp(joy.axes[0]) * 0.5f;
+      command_yaw_ = clamp(joy.axes[2]) * 0.5f;
+    }
+  }
+
+  // One controller session, from stand-up until stopped
+  void control()
+  {
+    const limxsdk::rl::PolicyConfig& config = policies_.active().config();
+    // PolicySet only holds policies of the same loop frequency, so the rate stays valid across switches
+    const int64_t budget_ns = static_cast<int64_t>(1e9 / config.loopFrequency);
+    policies_.reset();
+    selected_policy_ = static_cast<int>(policies_.activeIndex());
+    applyPolicySettings();
+    requested_policy_ = -1;
+    tick_latency_.reset();
+    inference_latency_.reset();
+    encoder_offload_.reset();
+    encoder_wait_.reset();
+    shadow_latency_.reset();
+    shadow_.resetStats();
+    joint_safety_.resetCounters();
+    first_inference_ns_ = -1;
+    auto last_report = std::chrono::steady_clock::now();
+
+    limxsdk::ability::Rate rate(config.loopFrequency);
+    while (running_ && controller_running_)
+    {
+      const auto start = std::chrono::steady_clock::now();
+      const JointSample state = state_.load();
+      limxsdk::ImuData imu = imu_.load();
+      if (imu_averaging_)
+      {
+        applyImuWindow(imu);
+      }
+      if (use_imu_estimator_)
+      {
+        applyImuEstimate(imu);
+      }
+      if (state.count < static_cast<uint32_t>(config.jointCount()))
+      {
+        // No robot state yet, keep waiting at the loop rate
+        rate.sleep();
+        continue;
+      }
+
+      const int requested = requested_policy_.exchange(-1);
+      if (requested >= 0 && policies_.select(static_cast<size_t>(requested)))
+      {
+        selected_policy_ = requested;
+        std::cout << "RL locomotion: switching to " << policies_.name(requested) << std::endl;
+      }
+      policies_.setCommands(command_x_, command_y_, command_yaw_);
+      const bool updated = policies_.update(state.q, state.dq, imu, cmd_);
+      if (!updated)
+      {
+        diag_inference_.publish(get_robot_instance());
+      }
+      if (policies_.activeIndex() != applied_policy_)
+      {
+        applyPolicySettings();
+      }
+      cmd_.stamp = state.stamp;
+      // Stand-up keeps the feed-forward of its mode; a failed update holds a command that already has the term
+      if (gravity_compensation_ && updated &&
+          policies_.active().mode() == limxsdk::rl::LocomotionController::Mode::WALK)
+      {
+        applyGravityCompensation(state, imu);
+      }
+      if (joint_safety_enabled_)
+      {
+        joint_safety_.apply(state.q, state.dq, cmd_);
+      }
+      publish_robot_cmd(cmd_);
+
+      // Shadow candidates run after the command is out, on the live policy's inputs only
+      if (shadow_.size() > 0 && policies_.activeIndex() == 0 && !policies_.switching() &&
+          shadow_.evaluate(policies_.active()))
+      {
+        shadow_latency_.record(shadow_.lastNs());
+      }
+
+      const int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start).count();
+      tick_latency_.record(elapsed);
+      const limxsdk::rl::LocomotionController& controller = policies_.active();
+      if (controller.inferred() && first_inference_ns_ < 0)
+      {
+        // The first walk step is reported on its own so it does not hide in the steady-state percentiles
+        first_inference_ns_ = controller.inferenceNs();
+      }
+      else if (controller.inferred())
+      {
+        inference_latency_.record(controller.inferenceNs());
+        if (controller.pipelined())
+        {
+          encoder_offload_.record(controller.encoderNs());
+          encoder_wait_.record(controller.encoderWaitNs());
+        }
+      }
+      if (elapsed > budget_ns)
+      {
+        diag_latency_.publish(get_robot_instance());
+      }
+
+      if (report_interval_ > 0.0 &&
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - last_report).count() >= report_interval_)
+      {
+        report();
+        last_report = std::chrono::steady_clock::now();
+      }
+      rate.sleep();
+    }
+
+    // Release the joints with damping only
+    limxsdk::rl::LocomotionController::safeStop(cmd_);
+    publish_robot_cmd(cmd_);
+    policies_.active().prepareCommand(cmd_);
+    report();
+  }
+
+  void report() const
+  {
+    std::printf("RL locomotion latency [us]: tick mean %.1f p50 %.1f p99 %.1f max %.1f (%llu) | "
+                "inference first %.1f, then mean %.1f p99 %.1f max %.1f (%llu) | overruns %llu\n",
+                tick_latency_.mean_ns() / 1e3, tick_latency_.percentile_ns(0.5) / 1e3,
+                tick_latency_.percentile_ns(0.99) / 1e3, tick_latency_.max_ns() / 1e3,
+                static_cast<unsigned long long>(tick_latency_.count()),
+                first_inference_ns_ < 0 ? 0.0 : first_inference_ns_ / 1e3, inference_latency_.mean_ns() / 1e3,
+                inference_latency_.percentile_ns(0.99) / 1e3, inference_latency_.max_ns() / 1e3,
+                static_cast<unsigned long long>(inference_latency_.count()),
+                static_cast<unsigned long long>(getLoopStats().overruns.load()));
+    if (policies_.size() > 1)
+    {
+      std::printf("RL locomotion policy: %s (%llu switches)\n", policies_.name(policies_.activeIndex()).c_str(),
+                  static_cast<unsigned long long>(policies_.switches()));
+    }
+    for (size_t i = 0; i < shadow_.size(); ++i)
+    {
+      const limxsdk::rl::ActionDeltaStats& stats = shadow_.stats(i);
+      std::printf("RL locomotion shadow %s: %llu steps, |action delta| mean %.4f rms %.4f max %.4f\n",
+                  shadow_.name(i).c_str(), static_cast<unsigned long long>(stats.steps), stats.mean(), stats.rms(),
+                  stats.maxAbs);
+    }
+    if (shadow_.size() > 0)
+    {
+      std::printf("RL locomotion shadow [us]: mean %.1f p99 %.1f max %.1f per policy step\n",
+                  shadow_latency_.mean_ns() / 1e3, shadow_latency_.percentile_ns(0.99) / 1e3,
+                  shadow_latency_.max_ns() / 1e3);
+    }
+    if (joint_safety_enabled_ && joint_safety_.ticks() > 0)
+    {
+      // Share of ticks in which each limit changed a joint's command, only for joints that were clamped
+      const limxsdk::rl::PolicyConfig& config = policies_.active().config();
+      const double ticks = static_cast<double>(joint_safety_.ticks());
+      for (size_t j = 0; j < joint_safety_.size(); ++j)
+      {
+        const limxsdk::rl::JointSafetyCounters& c = joint_safety_.counters(j);
+        if (c.position + c.velocity + c.torque > 0)
+        {
+          std::printf("RL locomotion joint safety %s: position %.2f%% velocity %.2f%% torque %.2f%% of %llu ticks\n",
+                      config.jointNames[j].c_str(), 100.0 * c.position / ticks, 100.0 * c.velocity / ticks,
+                      100.0 * c.torque / ticks, static_cast<unsigned long long>(joint_safety_.ticks()));
+        }
+      }
+    }
+    const limxsdk::rl::LocomotionController& controller = policies_.active();
+    if (controller.pipelined())
+    {
+      // The helper's encoder time is what the control thread saves, minus what it still waits for
+      std::printf("RL locomotion pipelined encoder [us]: saved mean %.1f p99 %.1f | wait mean %.1f max %.1f | "
+                  "latent age %.1f ms\n",
+                  (encoder_offload_.mean_ns() - encoder_wait_.mean_ns()) / 1e3,
+                  encoder_offload_.percentile_ns(0.99) / 1e3, encoder_wait_.mean_ns() / 1e3,
+                  encoder_wait_.max_ns() / 1e3, controller.latentAge() * 1e3);
+    }
+  }
+
+  static float clamp(float value)
+  {
+    return value > 1.0f ? 1.0f : (value < -1.0f ? -1.0f : value);
+  }
+
+  limxsdk::rl::PolicySet policies_;
+  limxsdk::rl::ShadowEvaluator shadow_;
+  limxsdk::RobotCmd cmd_;
+  limxsdk::ability::SeqLock<JointSample> state_;
+  limxsdk::ability::SeqLock<limxsdk::ImuData> imu_;
+  limxsdk::ability::ImuPreintegrator imu_window_;   // Fed by the IMU subscription when averaging
+  limxsdk::rl::JointSafety joint_safety_;           // Last stage before publish_robot_cmd
+  limxsdk::model::LegGeometry leg_geometry_;        // Used when gravity_compensation is on
+  limxsdk::ability::DiagnosticDispatcher diagnostics_;
+  limxsdk::ability::DiagnosticTemplate diag_latency_;
+  limxsdk::ability::DiagnosticTemplate diag_inference_;
+  limxsdk::ability::LatencyHistogram tick_latency_;
+  limxsdk::ability::LatencyHistogram inference_latency_;
+  limxsdk::ability::LatencyHistogram encoder_offload_;
+  limxsdk::ability::LatencyHistogram encoder_wait_;
+  limxsdk::ability::LatencyHistogram shadow_latency_;
+  std::atomic<bool> controller_running_{false};
+  std::atomic<int> calibration_state_{-1};
+  std::atomic<float> command_x_{0.0f};
+  std::atomic<float> command_y_{0.0f};
+  std::atomic<float> command_yaw_{0.0f};
+  std::atomic<int> requested_policy_{-1};    // Set by the joystick callback, applied by the control loop
+  std::atomic<int> selected_policy_{0};
+  size_t applied_policy_ = 0;                // Policy whose settings imu_window_ and joint_safety_ hold
+  bool switch_held_ = false;
+  std::string backend_;
+  std::string precision_name_;
+  limxsdk::rl::Precision precision_ = limxsdk::rl::Precision::FP32;
+  double max_action_error_ = 0.05;
+  int encoder_cpu_ = -1;
+  int warmup_iterations_ = 200;
+  bool use_imu_estimator_ = false;
+  bool imu_averaging_ = false;
+  bool joint_safety_enabled_ = true;
+  bool gravity_compensation_ = false;
+  int64_t first_inference_ns_ = -1;
+  bool start_immediately_ = false;
+  bool subscribed_ = false;
+  double report_interval_ = 10.0;
+};
+
+LIMX_REGISTER_ABILITY(RLLocomotionAbility)
@@ -0,0 +1,63 @@
+/**
+ * @file ability_status_monitor.cpp
+ * @brief Prints the shared-memory status page published by the AbilityManager.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ */
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "limxsdk/ability/status_page.h"
+
+/**
+ * @brief Main function.
+ * @param argc Number of command-line arguments.
+ * @param argv argv[1]: shared memory name (default "/limx_ability_status").
+ * @return Integer indicating the exit status.
+ */
+int main(int argc, char *argv[])
+{
+  std::string name = "/limx_ability_status"; // Default status page name
+  if (argc > 1)
+  {
+    name = argv[1];
+  }
+
+  limxsdk::ability::StatusPageReader reader;
+  while (!reader.open(name))
+  {
+    std::cout << "Waiting for status page " << name << "...\n";
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  limxsdk::ability::StatusPageData data;
+  uint32_t last_version = 0;
+  while (reader.read(data))
+  {
+    // Only print when the manager has published a new snapshot
+    if (reader.version() != last_version)
+    {
+      last_version = reader.version();
+      std::cout << "pid " << data.pid << ", " << data.ability_count << " abilities\n";
+      for (uint32_t i = 0; i < data.ability_count; ++i)
+      {
+        const limxsdk::ability::StatusPageAbility &entry = data.abilities[i];
+        std::cout << "  " << std::left << std::setw(24) << entry.name
+                  << (entry.running ? " running" : " stopped")
+                  << "  cycles " << entry.cycles
+                  << "  overruns " << entry.overruns
+                  << "  last " << entry.last_cycle_ns / 1000.0 << " us"
+                  << "  max " << entry.max_cycle_ns / 1000.0 << " us\n";
+      }
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  }
+
+  std::cout << "Status page closed\n";
+  return 0;
+}
@@ -0,0 +1,404 @@
+/**
+ * @file flight_log_export.cpp
+ * @brief Indexes a flight recorder session and exports selected fields into chunk-compressed columnar files.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Output format (one .lfc file per stream, little endian):
+ *   header   : char magic[8] = "LIMXCOL1", uint32 column_count, uint32 chunk_rows
+ *   columns  : column_count x { char name[48], uint32 dtype (0 = uint64, 1 = float32), uint32 width }
+ *   chunks   : { uint32 rows, column_count x { uint32 raw_bytes, uint32 packed_bytes, packed data } }
+ *   footer   : uint64 chunk_offsets[chunk_count], uint64 chunk_count, char magic[8] = "LIMXCEND"
+ * Column data of a chunk is a row-major [rows][width] array whose bytes are
+ * shuffled into planes (all byte 0s, then all byte 1s, ...) and deflated with zlib.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "limxsdk/ability/flight_index.h"
+
+using namespace limxsdk::ability;
+
+namespace
+{
+  enum ColumnType : uint32_t
+  {
+    COLUMN_UINT64 = 0,
+    COLUMN_FLOAT32 = 1,
+  };
+
+  /**
+   * @brief One output column, buffering the rows of the current chunk.
+   */
+  struct Column
+  {
+    std::string name;
+    ColumnType type;
+    uint32_t width;
+    std::vector<uint8_t> data;
+
+    size_t elementSize() const { return type == COLUMN_UINT64 ? 8 : 4; }
+  };
+
+  /**
+   * @brief Writes the columns of one stream into an .lfc file.
+   */
+  class ColumnWriter
+  {
+  public:
+    ColumnWriter(const std::string &path, uint32_t chunk_rows) : path_(path), chunk_rows_(chunk_rows), rows_(0) {}
+
+    void addColumn(const std::string &name, ColumnType type, uint32_t width)
+    {
+      Column column;
+      column.name = name;
+      column.type = type;
+      column.width = width;
+      columns_.push_back(column);
+    }
+
+    bool open()
+    {
+      out_.open(path_, std::ios::binary | std::ios::trunc);
+      if (!out_)
+      {
+        return false;
+      }
+      uint32_t count = static_cast<uint32_t>(columns_.size());
+      out_.write("LIMXCOL1", 8);
+      out_.write(reinterpret_cast<const char *>(&count), 4);
+      out_.write(reinterpret_cast<const char *>(&chunk_rows_), 4);
+      for (const auto &column : columns_)
+      {
+        char name[48] = {0};
+        std::strncpy(name, column.name.c_str(), sizeof(name) - 1);
+        uint32_t type = column.type;
+        out_.write(name, sizeof(name));
+        out_.write(reinterpret_cast<const char *>(&type), 4);
+        out_.write(reinterpret_cast<const char *>(&column.width), 4);
+      }
+      return true;
+    }
+
+    template <typename T>
+    void append(size_t i, const T *values, uint32_t count)
+    {
+      // Short rows (e.g. a joystick with fewer axes) are zero padded to the column width
+      Column &c = columns_[i];
+      size_t offset = c.data.size();
+      c.data.resize(offset + c.width * sizeof(T), 0);
+      std::memcpy(c.data.data() + offset, values, std::min(count, c.width) * sizeof(T));
+    }
+
+    bool endRow()
+    {
+      return ++rows_ < chunk_rows_ || flush();
+    }
+
+    bool close()
+    {
+      const bool flushed = flush();
+      uint64_t count = chunk_offsets_.size();
+      out_.write(reinterpret_cast<const char *>(chunk_offsets_.data()), count * sizeof(uint64_t));
+      out_.write(reinterpret_cast<const char *>(&count), sizeof(count));
+      out_.write("LIMXCEND", 8);
+      out_.close();
+      return flushed && !out_.fail();
+    }
+
+    uint64_t rowsWritten() const { return total_rows_; }
+    uint64_t rawBytes() const { return raw_bytes_; }
+    uint64_t packedBytes() const { return packed_bytes_; }
+
+  private:
+    bool flush()
+    {
+      if (rows_ == 0)
+      {
+        return true;
+      }
+      chunk_offsets_.push_back(static_cast<uint64_t>(out_.tellp()));
+      out_.write(reinterpret_cast<const char *>(&rows_), 4);
+      for (auto &column : columns_)
+      {
+        // Byte planes of slowly changing floats compress far better than interleaved values
+        const size_t element = column.elementSize();
+        const size_t count = column.data.size() / element;
+        shuffled_.resize(column.data.size());
+        for (size_t i = 0; i < count; ++i)
+        {
+          for (size_t b = 0; b < element; ++b)
+          {
+            shuffled_[b * count + i] = column.data[i * element + b];
+          }
+        }
+
+        uLongf packed_size = compressBound(static_cast<uLong>(shuffled_.size()));
+        packed_.resize(packed_size);
+        const int result = compress2(packed_.data(), &packed_size, shuffled_.data(),
+                                     static_cast<uLong>(shuffled_.size()), Z_DEFAULT_COMPRESSION);
+        if (result != Z_OK)
+        {
+          std::cerr << "Failed to compress column " << column.name << " of " << path_ << ": " << zError(result) << "\n";
+          return false;
+        }
+
+        uint32_t raw = static_cast<uint32_t>(shuffled_.size());
+        uint32_t size = static_cast<uint32_t>(packed_size);
+        out_.write(reinterpret_cast<const char *>(&raw), 4);
+        out_.write(reinterpret_cast<const char *>(&size), 4);
+        out_.write(reinterpret_cast<const char *>(packed_.data()), size);
+        raw_bytes_ += raw;
+        packed_bytes_ += size;
+        column.data.clear();
+      }
+      total_rows_ += rows_;
+      rows_ = 0;
+      return true;
+    }
+
+    std::string path_;
+    uint32_t chunk_rows_;
+    uint32_t rows_;
+    uint64_t total_rows_ = 0;
+    uint64_t raw_bytes_ = 0;
+    uint64_t packed_bytes_ = 0;
+    std::vector<Column> columns_;
+    std::vector<uint64_t> chunk_offsets_;
+    std::vector<uint8_t> shuffled_;
+    std::vector<Bytef> packed_;
+    std::ofstream out_;
+  };
+
+  /**
+   * @brief Fields selected for one stream, e.g. "state" -> {"q", "dq"}.
+   */
+  struct StreamExport
+  {
+    uint16_t type;
+    std::vector<std::string> fields;
+    std::unique_ptr<ColumnWriter> writer;
+  };
+
+  uint16_t streamType(const std::string &stream)
+  {
+    if (stream == "state") return FLIGHT_RECORD_ROBOT_STATE;
+    if (stream == "cmd") return FLIGHT_RECORD_ROBOT_CMD;
+    if (stream == "imu") return FLIGHT_RECORD_IMU_DATA;
+    if (stream == "joy") return FLIGHT_RECORD_SENSOR_JOY;
+    return 0;
+  }
+
+  /**
+   * @brief Returns the values of a field of a decoded record, or nullptr for an unknown field.
+   */
+  const float *fieldValues(const std::string &field, const limxsdk::RobotState &state, uint32_t &count)
+  {
+    count = static_cast<uint32_t>(state.q.size());
+    if (field == "q") return state.q.data();
+    if (field == "dq") return state.dq.data();
+    if (field == "tau") return state.tau.data();
+    return nullptr;
+  }
+
+  const float *fieldValues(const std::string &field, const limxsdk::RobotCmd &cmd, uint32_t &count)
+  {
+    count = static_cast<uint32_t>(cmd.q.size());
+    if (field == "q") return cmd.q.data();
+    if (field == "dq") return cmd.dq.data();
+    if (field == "tau") return cmd.tau.data();
+    if (field == "Kp") return cmd.Kp.data();
+    if (field == "Kd") return cmd.Kd.data();
+    return nullptr;
+  }
+
+  const float *fieldValues(const std::string &field, const limxsdk::ImuData &imu, uint32_t &count)
+  {
+    count = 3;
+    if (field == "acc") return imu.acc;
+    if (field == "gyro") return imu.gyro;
+    count = 4;
+    if (field == "quat") return imu.quat;
+    return nullptr;
+  }
+
+  const float *fieldValues(const std::string &field, const limxsdk::SensorJoy &joy, uint32_t &count)
+  {
+    count = static_cast<uint32_t>(joy.axes.size());
+    if (field == "axes") return joy.axes.data();
+    return nullptr;
+  }
+
+  /**
+   * @brief Creates the writer of a stream on its first record, sizing columns from that record.
+   */
+  template <typename Msg>
+  bool writeRow(StreamExport &stream, const FlightRecordView &record, const Msg &msg,
+                const std::string &path, uint32_t chunk_rows)
+  {
+    uint32_t count = 0;
+    if (!stream.writer)
+    {
+      stream.writer.reset(new ColumnWriter(path, chunk_rows));
+      stream.writer->addColumn("time", COLUMN_UINT64, 1);
+      stream.writer->addColumn("stamp", COLUMN_UINT64, 1);
+      for (const auto &field : stream.fields)
+      {
+        if (!fieldValues(field, msg, count))
+        {
+          std::cerr << "Unknown field: " << field << "\n";
+          return false;
+        }
+        stream.writer->addColumn(field, COLUMN_FLOAT32, count);
+      }
+      if (!stream.writer->open())
+      {
+        std::cerr << "Failed to create " << path << "\n";
+        return false;
+      }
+    }
+
+    uint64_t time = record.time();
+    stream.writer->append(0, &time, 1);
+    stream.writer->append(1, &msg.stamp, 1);
+    for (size_t i = 0; i < stream.fields.size(); ++i)
+    {
+      const float *values = fieldValues(stream.fields[i], msg, count);
+      stream.writer->append(i + 2, values, count);
+    }
+    return stream.writer->endRow();
+  }
+}
+
+/**
+ * @brief Main function.
+ * @param argc Number of command-line arguments.
+ * @param argv argv[1]: recording directory, argv[2]: output prefix, then options:
+ *             --fields state.q,state.dq,state.tau (default), --from <s>, --to <s>
+ *             (seconds from the start of the recording), --chunk <rows> (default 4096).
+ * @return Integer indicating the exit status.
+ */
+int main(int argc, char *argv[])
+{
+  if (argc < 3)
+  {
+    std::cout << "Usage: " << argv[0] << " <recording_dir> <output_prefix> [--fields state.q,imu.gyro,...]"
+              << " [--from seconds] [--to seconds] [--chunk rows]\n";
+    return 1;
+  }
+
+  std::string directory = argv[1];
+  std::string prefix = argv[2];
+  std::string fields = "state.q,state.dq,state.tau";
+  double from = 0.0;
+  double to = -1.0;
+  uint32_t chunk_rows = 4096;
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    std::string option = argv[i];
+    if (option == "--fields") fields = argv[i + 1];
+    else if (option == "--from") from = std::atof(argv[i + 1]);
+    else if (option == "--to") to = std::atof(argv[i + 1]);
+    else if (option == "--chunk") chunk_rows = static_cast<uint32_t>(std::max(1, std::atoi(argv[i + 1])));
+  }
+
+  // Group the requested fields by stream
+  std::map<uint16_t, StreamExport> streams;
+  std::map<uint16_t, std::string> stream_names;
+  std::stringstream field_list(fields);
+  std::string item;
+  while (std::getline(field_list, item, ','))
+  {
+    size_t dot = item.find('.');
+    uint16_t type = dot == std::string::npos ? 0 : streamType(item.substr(0, dot));
+    if (type == 0)
+    {
+      std::cerr << "Invalid field: " << item << " (expected state|cmd|imu|joy.<field>)\n";
+      return 1;
+    }
+    streams[type].type = type;
+    streams[type].fields.push_back(item.substr(dot + 1));
+    stream_names[type] = item.substr(0, dot);
+  }
+
+  FlightLogIndex index;
+  if (!index.loadOrBuild(directory))
+  {
+    std::cerr << "No recording found in " << directory << "\n";
+    return 1;
+  }
+  std::cout << "Indexed " << index.segmentCount() << " segments, " << index.entries().size() << " index points\n";
+
+  const uint64_t begin = index.startTime() + static_cast<uint64_t>(from * 1e9);
+  const uint64_t end = to < 0.0 ? UINT64_MAX : index.startTime() + static_cast<uint64_t>(to * 1e9);
+
+  FlightLogCursor cursor(index);
+  if (!cursor.seek(begin))
+  {
+    std::cerr << "Start time is past the end of the recording\n";
+    return 1;
+  }
+
+  FlightRecordView record;
+  limxsdk::RobotState state;
+  limxsdk::RobotCmd cmd;
+  limxsdk::ImuData imu;
+  limxsdk::SensorJoy joy;
+  while (cursor.next(record) && record.time() <= end)
+  {
+    auto it = streams.find(record.type());
+    if (it == streams.end())
+    {
+      continue;
+    }
+    const std::string path = prefix + "_" + stream_names[record.type()] + ".lfc";
+    bool ok = true;
+    switch (record.type())
+    {
+    case FLIGHT_RECORD_ROBOT_STATE:
+      ok = record.decode(state) && writeRow(it->second, record, state, path, chunk_rows);
+      break;
+    case FLIGHT_RECORD_ROBOT_CMD:
+      ok = record.decode(cmd) && writeRow(it->second, record, cmd, path, chunk_rows);
+      break;
+    case FLIGHT_RECORD_IMU_DATA:
+      ok = record.decode(imu) && writeRow(it->second, record, imu, path, chunk_rows);
+      break;
+    case FLIGHT_RECORD_SENSOR_JOY:
+      ok = record.decode(joy) && writeRow(it->second, record, joy, path, chunk_rows);
+      break;
+    }
+    if (!ok)
+    {
+      return 1;
+    }
+  }
+
+  for (auto &pair : streams)
+  {
+    ColumnWriter *writer = pair.second.writer.get();
+    if (!writer)
+    {
+      std::cout << stream_names[pair.first] << ": no records in range\n";
+      continue;
+    }
+    if (!writer->close())
+    {
+      std::cerr << "Failed to write " << prefix << "_" << stream_names[pair.first] << ".lfc\n";
+      return 1;
+    }
+    std::cout << prefix << "_" << stream_names[pair.first] << ".lfc: " << writer->rowsWritten() << " rows, "
+              << writer->rawBytes() << " -> " << writer->packedBytes() << " bytes\n";
+  }
+  return 0;
+}
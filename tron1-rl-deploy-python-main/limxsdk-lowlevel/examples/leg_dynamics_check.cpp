@@ -0,0 +1,246 @@
+/**
+ * @file leg_dynamics_check.cpp
+ * @brief Checks the leg inverse dynamics against the energy of the legs and times them.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   leg_dynamics_check [--samples N] [--iterations N] [--tolerance T]
+ *
+ * For every leg type, on N random states (default 1000):
+ *   gravity    gravity() against the gradient of the potential energy
+ *   power      tau . dq from inverseDynamics() against the rate of change
+ *              of kinetic plus potential energy along q, dq, ddq
+ *   symmetry   the mass matrix, column by column from inverseDynamics()
+ *   mirror     the right leg at mirrored angles against the left leg
+ * Errors are relative to the size of the torque or power, at least 1 Nm or
+ * 1 W, since the energies are differenced in float. The largest error of
+ * each check must stay below T (default 1e-3). inverseDynamics() and
+ * gravity() are then timed over --iterations calls (default 1000000). The
+ * exit code is non-zero if any check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include "limxsdk/model/leg_dynamics.h"
+
+using namespace limxsdk::model;
+
+namespace
+{
+  struct Errors
+  {
+    double gravity = 0.0;
+    double power = 0.0;
+    double symmetry = 0.0;
+    double mirror = 0.0;
+  };
+
+  template <LegType TYPE>
+  Errors check(int samples, std::mt19937 &rng)
+  {
+    typedef LegDynamics<TYPE> Dynamics;
+    const int n = Dynamics::LEGS * Dynamics::JOINTS;
+    const LegGeometry geometry = LegGeometry::nominal(TYPE);
+    const Dynamics dynamics(geometry);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    const float zero[3] = {0.0f, 0.0f, 0.0f};
+    // Steps balancing float rounding of the energies against truncation; ddq makes the power curve faster
+    const double h = 1e-2;
+    const double h_power = 2e-3;
+    Errors errors;
+
+    for (int s = 0; s < samples; ++s)
+    {
+      float q[n];
+      float dq[n];
+      float ddq[n];
+      for (int i = 0; i < n; ++i)
+      {
+        q[i] = unit(rng);
+        dq[i] = 3.0f * unit(rng);
+        ddq[i] = 20.0f * unit(rng);
+      }
+      // Tilted base: gravity of 9.81 m/s^2 in a random direction
+      float g[3] = {unit(rng), unit(rng), -2.0f};
+      const float norm = std::sqrt(g[0] * g[0] + g[1] * g[1] + g[2] * g[2]);
+      for (int k = 0; k < 3; ++k)
+      {
+        g[k] *= 9.81f / norm;
+      }
+
+      float tau[n];
+      dynamics.gravity(q, g, tau);
+      for (int i = 0; i < n; ++i)
+      {
+        float plus[n];
+        float minus[n];
+        std::copy(q, q + n, plus);
+        std::copy(q, q + n, minus);
+        plus[i] += static_cast<float>(h);
+        minus[i] -= static_cast<float>(h);
+        const double numeric = (dynamics.potentialEnergy(plus, g) - dynamics.potentialEnergy(minus, g)) / (2.0 * h);
+        errors.gravity = std::max(errors.gravity, std::fabs(numeric - tau[i]) / std::max(1.0, std::fabs(numeric)));
+      }
+
+      dynamics.inverseDynamics(q, dq, ddq, g, tau);
+      float qa[n];
+      float qb[n];
+      float dqa[n];
+      float dqb[n];
+      for (int i = 0; i < n; ++i)
+      {
+        qa[i] = q[i] + static_cast<float>(h_power) * dq[i];
+        qb[i] = q[i] - static_cast<float>(h_power) * dq[i];
+        dqa[i] = dq[i] + static_cast<float>(h_power) * ddq[i];
+        dqb[i] = dq[i] - static_cast<float>(h_power) * ddq[i];
+      }
+      const double energy_rate = (dynamics.kineticEnergy(qa, dqa) + dynamics.potentialEnergy(qa, g) -
+                                  dynamics.kineticEnergy(qb, dqb) - dynamics.potentialEnergy(qb, g)) /
+                                 (2.0 * h_power);
+      double power = 0.0;
+      double scale = 1.0;
+      for (int i = 0; i < n; ++i)
+      {
+        power += tau[i] * dq[i];
+        scale += std::fabs(tau[i] * dq[i]);
+      }
+      errors.power = std::max(errors.power, std::fabs(power - energy_rate) / scale);
+
+      // Column i of the mass matrix is the torque for a unit acceleration of joint i
+      float mass[n][n];
+      const float still[n] = {};
+      for (int i = 0; i < n; ++i)
+      {
+        float unit_ddq[n] = {};
+        unit_ddq[i] = 1.0f;
+        float column[n];
+        dynamics.inverseDynamics(q, still, unit_ddq, zero, column);
+        for (int r = 0; r < n; ++r)
+        {
+          mass[r][i] = column[r];
+        }
+      }
+      for (int r = 0; r < n; ++r)
+      {
+        for (int c = r + 1; c < n; ++c)
+        {
+          errors.symmetry = std::max(errors.symmetry, static_cast<double>(std::fabs(mass[r][c] - mass[c][r])));
+        }
+      }
+
+      // Right leg mirroring the left leg's angles, rates and accelerations under upright gravity
+      const float upright[3] = {0.0f, 0.0f, -9.81f};
+      float mq[n];
+      float mdq[n];
+      float mddq[n];
+      for (int i = 0; i < Dynamics::JOINTS; ++i)
+      {
+        const float flip = geometry.rightSign[i] * (geometry.axis[i] == 1 ? 1.0f : -1.0f);
+        mq[i] = q[i];
+        mdq[i] = dq[i];
+        mddq[i] = ddq[i];
+        mq[Dynamics::JOINTS + i] = flip * q[i];
+        mdq[Dynamics::JOINTS + i] = flip * dq[i];
+        mddq[Dynamics::JOINTS + i] = flip * ddq[i];
+      }
+      dynamics.inverseDynamics(mq, mdq, mddq, upright, tau);
+      for (int i = 0; i < Dynamics::JOINTS; ++i)
+      {
+        const float flip = geometry.rightSign[i] * (geometry.axis[i] == 1 ? 1.0f : -1.0f);
+        const float error = std::fabs(tau[i] - flip * tau[Dynamics::JOINTS + i]);
+        errors.mirror = std::max(errors.mirror, static_cast<double>(error));
+      }
+    }
+    return errors;
+  }
+
+  template <LegType TYPE, bool FULL>
+  double benchmark(int iterations)
+  {
+    typedef LegDynamics<TYPE> Dynamics;
+    const int n = Dynamics::LEGS * Dynamics::JOINTS;
+    const Dynamics dynamics(LegGeometry::nominal(TYPE));
+    float q[n];
+    float dq[n];
+    float tau[n];
+    for (int i = 0; i < n; ++i)
+    {
+      q[i] = 0.1f * i;
+      dq[i] = 0.2f * i;
+    }
+    const float g[3] = {0.0f, 0.0f, -9.81f};
+    volatile float sink = 0.0f;     // Keeps the loop from being optimized away
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+      q[0] += 1e-6f;
+      if (FULL)
+      {
+        dynamics.inverseDynamics(q, dq, dq, g, tau);
+      }
+      else
+      {
+        dynamics.gravity(q, g, tau);
+      }
+      sink += tau[n - 1];
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / iterations;
+  }
+
+  template <LegType TYPE>
+  bool run(const char *name, int samples, int iterations, double tolerance, std::mt19937 &rng)
+  {
+    const Errors e = check<TYPE>(samples, rng);
+    const bool ok = e.gravity <= tolerance && e.power <= tolerance && e.symmetry <= tolerance &&
+                    e.mirror <= tolerance;
+    std::printf("%-10s %2d joints  gravity %.1e  power %.1e  symmetry %.1e  mirror %.1e  "
+                "rnea %6.1f ns  gravity %6.1f ns  %s\n",
+                name, LegDynamics<TYPE>::LEGS * LegDynamics<TYPE>::JOINTS, e.gravity, e.power, e.symmetry, e.mirror,
+                benchmark<TYPE, true>(iterations), benchmark<TYPE, false>(iterations), ok ? "ok" : "FAILED");
+    return ok;
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int samples = 1000;
+  int iterations = 1000000;
+  double tolerance = 1e-3;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--samples" && has_value)
+    {
+      samples = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--iterations" && has_value)
+    {
+      iterations = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--tolerance" && has_value)
+    {
+      tolerance = std::atof(argv[++i]);
+    }
+    else
+    {
+      std::printf("Usage: leg_dynamics_check [--samples N] [--iterations N] [--tolerance T]\n");
+      return arg == "-h" || arg == "--help" ? 0 : 1;
+    }
+  }
+
+  std::mt19937 rng(7);
+  bool ok = run<LegType::POINTFOOT>("PointFoot", samples, iterations, tolerance, rng);
+  ok = run<LegType::SOLEFOOT>("SoleFoot", samples, iterations, tolerance, rng) && ok;
+  ok = run<LegType::WHEELFOOT>("WheelFoot", samples, iterations, tolerance, rng) && ok;
+  return ok ? 0 : 2;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file leg_kinematics_check.cpp
+ * @brief Checks the compile-time leg kinematics against finite differences and times them.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   leg_kinematics_check [--samples N] [--iterations N] [--tolerance T]
+ *
+ * For every leg type, on N random joint configurations (default 1000):
+ *   jacobian   every column against a central difference of the point position
+ *   velocity   J * dq against the position difference along dq
+ *   torques    J^T * f against the virtual work f . (J * dq)
+ *   mirror     the right leg at mirrored angles against the left leg mirrored in y
+ * The largest error of each check must stay below T (default 1e-3 m/rad).
+ * compute() is then timed over --iterations calls (default 1000000). The
+ * exit code is non-zero if any check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include "limxsdk/model/leg_kinematics.h"
+
+using namespace limxsdk::model;
+
+namespace
+{
+  struct Errors
+  {
+    double jacobian = 0.0;
+    double velocity = 0.0;
+    double torques = 0.0;
+    double mirror = 0.0;
+  };
+
+  template <LegType TYPE>
+  Errors check(int samples, std::mt19937 &rng)
+  {
+    typedef LegKinematics<TYPE> Kinematics;
+    const int n = Kinematics::LEGS * Kinematics::JOINTS;
+    const LegGeometry geometry = LegGeometry::nominal(TYPE);
+    const Kinematics kinematics(geometry);
+    std::uniform_real_distribution<float> angle(-1.0f, 1.0f);
+    const float h = 1e-3f;
+    Errors errors;
+
+    for (int s = 0; s < samples; ++s)
+    {
+      float q[n];
+      float dq[n];
+      for (int i = 0; i < n; ++i)
+      {
+        q[i] = angle(rng);
+        dq[i] = angle(rng);
+      }
+      typename Kinematics::State state;
+      kinematics.compute(q, state);
+
+      for (int i = 0; i < n; ++i)
+      {
+        float plus[n];
+        float minus[n];
+        std::copy(q, q + n, plus);
+        std::copy(q, q + n, minus);
+        plus[i] += h;
+        minus[i] -= h;
+        typename Kinematics::State a;
+        typename Kinematics::State b;
+        kinematics.compute(plus, a);
+        kinematics.compute(minus, b);
+        const int leg = i / Kinematics::JOINTS;
+        for (int other = 0; other < Kinematics::LEGS; ++other)
+        {
+          for (int r = 0; r < 3; ++r)
+          {
+            const double numeric = (a.position[other][r] - b.position[other][r]) / (2.0 * h);
+            // A joint only moves the point of its own leg
+            const double analytic = other == leg ? state.jacobian[leg][r][i % Kinematics::JOINTS] : 0.0;
+            errors.jacobian = std::max(errors.jacobian, std::fabs(numeric - analytic));
+          }
+        }
+      }
+
+      float v[Kinematics::LEGS][3];
+      Kinematics::velocity(state, dq, v);
+      float plus[n];
+      float minus[n];
+      for (int i = 0; i < n; ++i)
+      {
+        plus[i] = q[i] + h * dq[i];
+        minus[i] = q[i] - h * dq[i];
+      }
+      typename Kinematics::State a;
+      typename Kinematics::State b;
+      kinematics.compute(plus, a);
+      kinematics.compute(minus, b);
+      float force[Kinematics::LEGS][3];
+      double work = 0.0;
+      for (int leg = 0; leg < Kinematics::LEGS; ++leg)
+      {
+        for (int r = 0; r < 3; ++r)
+        {
+          const double numeric = (a.position[leg][r] - b.position[leg][r]) / (2.0 * h);
+          errors.velocity = std::max(errors.velocity, std::fabs(numeric - v[leg][r]));
+          force[leg][r] = angle(rng) * 100.0f;
+          work += force[leg][r] * v[leg][r];
+        }
+      }
+      float tau[n];
+      Kinematics::torques(state, force, tau);
+      double power = 0.0;
+      for (int i = 0; i < n; ++i)
+      {
+        power += tau[i] * dq[i];
+      }
+      // Relative to the force scale, so the bound is in metres like the others
+      errors.torques = std::max(errors.torques, std::fabs(power - work) / 100.0);
+
+      // Right leg at the mirrored angles of the left leg
+      float mirrored[n];
+      for (int i = 0; i < Kinematics::JOINTS; ++i)
+      {
+        mirrored[i] = q[i];
+        mirrored[Kinematics::JOINTS + i] = q[i] * geometry.rightSign[i] * (geometry.axis[i] == 1 ? 1.0f : -1.0f);
+      }
+      kinematics.compute(mirrored, a);
+      errors.mirror = std::max(errors.mirror, static_cast<double>(std::fabs(a.position[0][0] - a.position[1][0])));
+      errors.mirror = std::max(errors.mirror, static_cast<double>(std::fabs(a.position[0][1] + a.position[1][1])));
+      errors.mirror = std::max(errors.mirror, static_cast<double>(std::fabs(a.position[0][2] - a.position[1][2])));
+    }
+    return errors;
+  }
+
+  template <LegType TYPE>
+  double benchmark(int iterations)
+  {
+    typedef LegKinematics<TYPE> Kinematics;
+    const Kinematics kinematics(LegGeometry::nominal(TYPE));
+    float q[Kinematics::LEGS * Kinematics::JOINTS];
+    for (int i = 0; i < Kinematics::LEGS * Kinematics::JOINTS; ++i)
+    {
+      q[i] = 0.1f * i;
+    }
+    typename Kinematics::State state;
+    volatile float sink = 0.0f;     // Keeps the loop from being optimized away
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+      q[0] += 1e-6f;
+      kinematics.compute(q, state);
+      sink += state.position[1][2];
+    }
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / iterations;
+  }
+
+  template <LegType TYPE>
+  bool run(const char *name, int samples, int iterations, double tolerance, std::mt19937 &rng)
+  {
+    const Errors e = check<TYPE>(samples, rng);
+    const bool ok = e.jacobian <= tolerance && e.velocity <= tolerance && e.torques <= tolerance &&
+                    e.mirror <= tolerance;
+    std::printf("%-10s %2d joints  jacobian %.1e  velocity %.1e  torques %.1e  mirror %.1e  %7.1f ns  %s\n", name,
+                LegKinematics<TYPE>::LEGS * LegKinematics<TYPE>::JOINTS, e.jacobian, e.velocity, e.torques,
+                e.mirror, benchmark<TYPE>(iterations), ok ? "ok" : "FAILED");
+    return ok;
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int samples = 1000;
+  int iterations = 1000000;
+  double tolerance = 1e-3;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--samples" && has_value)
+    {
+      samples = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--iterations" && has_value)
+    {
+      iterations = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--tolerance" && has_value)
+    {
+      tolerance = std::atof(argv[++i]);
+    }
+    else
+    {
+      std::printf("Usage: leg_kinematics_check [--samples N] [--iterations N] [--tolerance T]\n");
+      return arg == "-h" || arg == "--help" ? 0 : 1;
+    }
+  }
+
+  std::mt19937 rng(7);
+  bool ok = run<LegType::POINTFOOT>("PointFoot", samples, iterations, tolerance, rng);
+  ok = run<LegType::SOLEFOOT>("SoleFoot", samples, iterations, tolerance, rng) && ok;
+  ok = run<LegType::WHEELFOOT>("WheelFoot", samples, iterations, tolerance, rng) && ok;
+  return ok ? 0 : 2;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file loopback_check.cpp
+ * @brief Checks the loopback simulator against closed-form joint behaviour and times it.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   loopback_check [--model PointFoot|SoleFoot|WheelFoot] [--seconds S] [--tolerance T]
+ *                  [--energy-tolerance E]
+ *
+ * Runs the simulator without any robot or external process:
+ *   hold       PD control of every joint to 0.5 rad settles within T rad
+ *              (default 1e-3) of where Kp times the error balances the
+ *              gravity torque of the joint
+ *   energy     with the actuators off and no friction, the energy of every
+ *              swinging joint stays within E (default 1e-2) of its initial
+ *              value; the fixed step makes it oscillate by about dt * omega / 2
+ *   lockstep   a controller thread answering every RobotState, with the
+ *              simulator as fast as possible, sees every period exactly once
+ * Every check runs S simulated seconds (default 3). The simulated periods
+ * per wall second of the step() and lockstep runs are printed. The exit code
+ * is non-zero if any check fails.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "limxsdk/loopback.h"
+
+namespace
+{
+  typedef std::function<void(const limxsdk::RobotStateConstPtr &)> StateHandler;
+
+  // The simulator is a singleton without unsubscribe; its one subscription calls the handler of the running check
+  StateHandler on_state;
+
+  const float HOLD_TARGET = 0.5f;
+  const float HOLD_KP = 60.0f;
+  const float HOLD_KD = 3.0f;
+
+  limxsdk::RobotCmd holdCommand(size_t joints)
+  {
+    limxsdk::RobotCmd cmd(joints);
+    for (size_t j = 0; j < joints; ++j)
+    {
+      cmd.q[j] = HOLD_TARGET;
+      cmd.Kp[j] = HOLD_KP;
+      cmd.Kd[j] = HOLD_KD;
+    }
+    return cmd;
+  }
+
+  /**
+   * @brief Largest distance of a joint from the angle where Kp (target - q) equals its gravity torque.
+   */
+  double checkHold(limxsdk::Loopback &sim, const std::vector<limxsdk::LoopbackJoint> &joints, double seconds,
+                   double &periods_per_second)
+  {
+    sim.setJoints(joints);
+    limxsdk::RobotState state;
+    on_state = [&](const limxsdk::RobotStateConstPtr &msg) { state = *msg; };
+    sim.publishRobotCmd(holdCommand(joints.size()));
+
+    const uint64_t periods = static_cast<uint64_t>(seconds * 1000.0);
+    const auto start = std::chrono::steady_clock::now();
+    sim.step(periods);
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    periods_per_second = periods / wall;
+
+    double error = 0.0;
+    for (size_t j = 0; j < joints.size(); ++j)
+    {
+      // Fixed point of q = target - gravity sin(q - zero) / Kp
+      double q = HOLD_TARGET;
+      for (int i = 0; i < 100; ++i)
+      {
+        q = HOLD_TARGET - joints[j].gravity * std::sin(q - joints[j].gravityZero) / HOLD_KP;
+      }
+      error = std::max(error, std::fabs(state.q[j] - q));
+    }
+    return error;
+  }
+
+  /**
+   * @brief Largest relative drift of kinetic plus potential energy of the joints swinging freely.
+   */
+  double checkEnergy(limxsdk::Loopback &sim, std::vector<limxsdk::LoopbackJoint> joints, double seconds)
+  {
+    for (auto &joint : joints)
+    {
+      joint.damping = 0.0f;
+      joint.friction = 0.0f;
+      joint.initial = joint.gravityZero + 0.5f;
+    }
+    sim.setJoints(joints);
+    double drift = 0.0;
+    std::vector<double> initial(joints.size(), -1.0);
+    on_state = [&](const limxsdk::RobotStateConstPtr &msg) {
+      for (size_t j = 0; j < joints.size(); ++j)
+      {
+        if (joints[j].gravity <= 0.0f)
+        {
+          continue;
+        }
+        const double energy = 0.5 * joints[j].inertia * msg->dq[j] * msg->dq[j] +
+                              joints[j].gravity * (1.0 - std::cos(msg->q[j] - joints[j].gravityZero));
+        if (initial[j] < 0.0)
+        {
+          initial[j] = energy;
+        }
+        drift = std::max(drift, std::fabs(energy - initial[j]) / initial[j]);
+      }
+    };
+    sim.step(static_cast<uint64_t>(seconds * 1000.0));
+    return drift;
+  }
+
+  /**
+   * @brief Runs a controller thread against the simulation thread; returns the periods it missed or repeated.
+   */
+  uint64_t checkLockstep(limxsdk::Loopback &sim, const std::vector<limxsdk::LoopbackJoint> &joints, double seconds,
+                         double &periods_per_second)
+  {
+    sim.setJoints(joints);
+    std::mutex mtx;
+    std::condition_variable cv;
+    uint64_t stamp = 0;
+    uint64_t states = 0;
+    on_state = [&](const limxsdk::RobotStateConstPtr &msg) {
+      std::lock_guard<std::mutex> lock(mtx);
+      stamp = msg->stamp;
+      states++;
+      cv.notify_one();
+    };
+
+    const uint64_t periods = static_cast<uint64_t>(seconds * 1000.0);
+    uint64_t answered = 0;
+    uint64_t mismatched = 0;
+    std::thread controller([&]() {
+      limxsdk::RobotCmd cmd = holdCommand(joints.size());
+      uint64_t last = 0;
+      while (answered < periods)
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (!cv.wait_for(lock, std::chrono::seconds(1), [&]() { return stamp != last; }))
+        {
+          break;
+        }
+        mismatched += states != answered + 1;
+        last = stamp;
+        cmd.stamp = stamp;
+        lock.unlock();
+        sim.publishRobotCmd(cmd);
+        answered++;
+      }
+    });
+
+    sim.setSpeed(limxsdk::Loopback::AS_FAST_AS_POSSIBLE);
+    sim.setLockstep(true);
+    const auto start = std::chrono::steady_clock::now();
+    sim.start();
+    controller.join();
+    sim.stop();
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    periods_per_second = answered / wall;
+    return mismatched + (periods - answered);
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  std::string model = "PointFoot";
+  double seconds = 3.0;
+  double tolerance = 1e-3;
+  double energy_tolerance = 1e-2;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--model" && has_value)
+    {
+      model = argv[++i];
+    }
+    else if (arg == "--seconds" && has_value)
+    {
+      seconds = std::max(0.1, std::atof(argv[++i]));
+    }
+    else if (arg == "--tolerance" && has_value)
+    {
+      tolerance = std::atof(argv[++i]);
+    }
+    else if (arg == "--energy-tolerance" && has_value)
+    {
+      energy_tolerance = std::atof(argv[++i]);
+    }
+    else
+    {
+      std::printf("Usage: loopback_check [--model PointFoot|SoleFoot|WheelFoot] [--seconds S] [--tolerance T]"
+                  " [--energy-tolerance E]\n");
+      return arg == "-h" || arg == "--help" ? 0 : 1;
+    }
+  }
+
+  limxsdk::Loopback *sim = limxsdk::Loopback::getInstance();
+  if (!sim->init(model))
+  {
+    return 1;
+  }
+  sim->subscribeRobotState([](const limxsdk::RobotStateConstPtr &msg) { on_state(msg); });
+  const std::vector<limxsdk::LoopbackJoint> joints = sim->joints();
+
+  double step_rate = 0.0;
+  double lockstep_rate = 0.0;
+  const double hold = checkHold(*sim, joints, seconds, step_rate);
+  const double energy = checkEnergy(*sim, joints, seconds);
+  const uint64_t missed = checkLockstep(*sim, joints, seconds, lockstep_rate);
+  const bool ok = hold <= tolerance && energy <= energy_tolerance && missed == 0;
+  std::printf("%-10s %2zu joints  hold %.1e rad  energy %.1e  lockstep %llu missed  "
+              "step %.0f periods/s  lockstep %.0f periods/s  %s\n",
+              model.c_str(), joints.size(), hold, energy, static_cast<unsigned long long>(missed), step_rate,
+              lockstep_rate, ok ? "ok" : "FAILED");
+  return ok ? 0 : 2;
+}
@@ -9,12 +9,19 @@
  */
 
 #include "pf_controller_base.h"
+#include <cmath>
 
 // Constructor
 PFControllerBase::PFControllerBase()
+    : PFControllerBase(limxsdk::PointFoot::getInstance())
 {
-  // Initialize PointFoot instance and robot command/state objects
-  pf_ = limxsdk::PointFoot::getInstance();
+}
+
+// Constructor for a given robot backend
+PFControllerBase::PFControllerBase(limxsdk::ApiBase *robot)
+{
+  // Initialize robot instance and robot command/state objects
+  pf_ = robot;
   robotstate_on_ = false;
   robot_cmd_ = limxsdk::RobotCmd(pf_->getMotorNumber());
   robot_state_ = limxsdk::RobotState(pf_->getMotorNumber());
@@ -39,17 +46,119 @@ PFControllerBase::~PFControllerBase()
 {
 }
 
-// Function to control a single joint
-void PFControllerBase::singleJointController(int jointId, double kp, double kd,
-                                             double targetPos, double targetVel,
-                                             double targetTorque)
+// Start recording the robot streams and committed commands
+bool PFControllerBase::startFlightRecorder(const limxsdk::ability::FlightRecorderConfig &config)
+{
+  if (recorder_)
+  {
+    return recorder_->isRecording();
+  }
+  recorder_ = std::unique_ptr<limxsdk::ability::FlightRecorder>(new limxsdk::ability::FlightRecorder());
+  if (!recorder_->start(config))
+  {
+    recorder_.reset();
+    return false;
+  }
+  recorder_->attach(pf_);
+  return true;
+}
+
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+// Clamp committed commands to the joint limits of config
+bool PFControllerBase::enableJointSafety(const limxsdk::rl::PolicyConfig &config)
+{
+  if (config.jointCount() != static_cast<int>(robot_cmd_.q.size()))
+  {
+    std::cerr << "PFControllerBase: " << config.robotType << " has " << config.jointCount() << " joints, the robot has "
+              << robot_cmd_.q.size() << std::endl;
+    return false;
+  }
+  joint_safety_.configure(config);
+  return true;
+}
+#endif
+
+// Open the command of this tick
+void PFControllerBase::beginCommand()
+{
+  if (command_open_)
+  {
+    std::cerr << "PFControllerBase: beginCommand() while a command is open, its joints are kept" << std::endl;
+  }
+  command_open_ = true;
+  mtx_.lock();
+  robot_cmd_.stamp = robot_state_.stamp;
+  mtx_.unlock();
+}
+
+// Set one joint of the open command
+void PFControllerBase::setJoint(int jointId, double kp, double kd, double targetPos, double targetVel,
+                                double targetTorque)
 {
   robot_cmd_.Kp[jointId] = kp;
   robot_cmd_.Kd[jointId] = kd;
   robot_cmd_.q[jointId] = targetPos;
   robot_cmd_.dq[jointId] = targetVel;
   robot_cmd_.tau[jointId] = targetTorque;
+}
+
+// Set every joint of the open command
+void PFControllerBase::setAllJoints(double kp, double kd, double targetPos, double targetVel, double targetTorque)
+{
+  for (size_t i = 0; i < robot_cmd_.q.size(); ++i)
+  {
+    setJoint(i, kp, kd, targetPos, targetVel, targetTorque);
+  }
+}
+
+// Validate and publish the open command
+bool PFControllerBase::commitCommand()
+{
+  if (!command_open_)
+  {
+    std::cerr << "PFControllerBase: commitCommand() without beginCommand()" << std::endl;
+    return false;
+  }
+  command_open_ = false;
+  for (size_t i = 0; i < robot_cmd_.q.size(); ++i)
+  {
+    if (!std::isfinite(robot_cmd_.q[i]) || !std::isfinite(robot_cmd_.dq[i]) || !std::isfinite(robot_cmd_.tau[i]) ||
+        !std::isfinite(robot_cmd_.Kp[i]) || !std::isfinite(robot_cmd_.Kd[i]) || robot_cmd_.Kp[i] < 0.0f ||
+        robot_cmd_.Kd[i] < 0.0f)
+    {
+      std::cerr << "PFControllerBase: invalid command for joint " << i << ", not published" << std::endl;
+      return false;
+    }
+  }
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+  if (joint_safety_.size() > 0)
+  {
+    mtx_.lock();
+    joint_safety_.apply(robot_state_.q.data(), robot_state_.dq.data(), robot_cmd_);
+    mtx_.unlock();
+  }
+#endif
+  if (recorder_)
+  {
+    recorder_->recordRobotCmd(robot_cmd_);
+  }
   pf_->publishRobotCmd(robot_cmd_);
+  return true;
+}
+
+// Function to control a single joint
+void PFControllerBase::singleJointController(int jointId, double kp, double kd,
+                                             double targetPos, double targetVel,
+                                             double targetTorque)
+{
+  if (command_open_)
+  {
+    setJoint(jointId, kp, kd, targetPos, targetVel, targetTorque);
+    return;
+  }
+  beginCommand();
+  setJoint(jointId, kp, kd, targetPos, targetVel, targetTorque);
+  commitCommand();
 }
 
 // Function to control all joints simultaneously
@@ -57,41 +166,26 @@ void PFControllerBase::groupJointController(std::vector<float> &kp, std::vector<
                                             std::vector<float> &targetPos, std::vector<float> &targetVel,
                                             std::vector<float> &targetTorque)
 {
+  beginCommand();
   for (size_t i = 0; i < pf_->getMotorNumber(); ++i)
   {
-    robot_cmd_.Kp[i] = kp[i];
-    robot_cmd_.Kd[i] = kd[i];
-    robot_cmd_.q[i] = targetPos[i];
-    robot_cmd_.dq[i] = targetVel[i];
-    robot_cmd_.tau[i] = targetTorque[i];
+    setJoint(i, kp[i], kd[i], targetPos[i], targetVel[i], targetTorque[i]);
   }
-  pf_->publishRobotCmd(robot_cmd_);
+  commitCommand();
 }
 
 // Function to publish zero torque commands
 void PFControllerBase::zeroTorque()
 {
-  for (size_t i = 0; i < pf_->getMotorNumber(); ++i)
-  {
-    robot_cmd_.Kp[i] = 0.0;
-    robot_cmd_.Kd[i] = 0.0;
-    robot_cmd_.q[i] = 0.0;
-    robot_cmd_.dq[i] = 0.0;
-    robot_cmd_.tau[i] = 0.0;
-  }
-  pf_->publishRobotCmd(robot_cmd_);
+  beginCommand();
+  setAllJoints(0.0, 0.0, 0.0, 0.0, 0.0);
+  commitCommand();
 }
 
 // Function to publish damping commands
 void PFControllerBase::damping()
 {
-  for (size_t i = 0; i < pf_->getMotorNumber(); ++i)
-  {
-    robot_cmd_.Kp[i] = 0.0;
-    robot_cmd_.Kd[i] = 4.0; // Assuming 4 as the damping value
-    robot_cmd_.q[i] = 0.0;
-    robot_cmd_.dq[i] = 0.0;
-    robot_cmd_.tau[i] = 0.0;
-  }
-  pf_->publishRobotCmd(robot_cmd_);
+  beginCommand();
+  setAllJoints(0.0, 4.0, 0.0, 0.0, 0.0); // Assuming 4 as the damping value
+  commitCommand();
 }
@@ -12,6 +12,12 @@
 #include <mutex>               // Include for std::mutex
 #include <vector>              // Include for std::vector
 #include "limxsdk/pointfoot.h"// Include for limxsdk::PointFoot
+#include "limxsdk/ability/diagnostics.h" // Include for limxsdk::ability::DiagnosticDispatcher
+#include "limxsdk/ability/flight_recorder.h" // Include for limxsdk::ability::FlightRecorder
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+#include "limxsdk/rl/joint_safety.h" // Include for limxsdk::rl::JointSafety (needs yaml-cpp)
+#endif
+#include <memory>              // Include for std::unique_ptr
 #include <Eigen/Dense>         // Include for Eigen library (dense matrix algebra)
 #include <iostream>            // Include for standard input/output operations
 #include "unistd.h"            // Include for usleep function (Unix standard)
@@ -31,15 +37,75 @@ public:
    */
   PFControllerBase();
 
+  /**
+   * @brief Constructor of the PFControllerBase class for another robot backend,
+   *        e.g. limxsdk::Replay to run the controller against a recorded log.
+   *
+   * @param robot Initialized robot instance.
+   */
+  explicit PFControllerBase(limxsdk::ApiBase *robot);
+
   /**
    * @brief Destructor of the PFControllerBase class.
    */
   ~PFControllerBase();
 
+  /**
+   * @brief Starts recording the robot streams and every committed command.
+   *
+   * Can only be started once per process because SDK subscriptions cannot be removed.
+   *
+   * @param config Flight recorder configuration.
+   * @return False if the recorder cannot be started.
+   */
+  bool startFlightRecorder(const limxsdk::ability::FlightRecorderConfig &config);
+
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+  /**
+   * @brief Clamps every committed command to the joint_limits and torque limits
+   *        of @p config against the latest robot state, as RLLocomotionAbility does.
+   *
+   * @param config Policy configuration whose joints are in motor order.
+   * @return False if @p config does not have one joint per motor.
+   */
+  bool enableJointSafety(const limxsdk::rl::PolicyConfig &config);
+#endif
+
 protected:
+  /**
+   * @brief Starts the command of this tick, stamped with the latest robot state.
+   *
+   * Joints set with setJoint()/setAllJoints() until commitCommand() are
+   * published together; joints not set keep their previous command.
+   */
+  void beginCommand();
+
+  /**
+   * @brief Sets one joint of the open command.
+   */
+  void setJoint(int jointId, double kp, double kd, double targetPos, double targetVel, double targetTorque);
+
+  /**
+   * @brief Sets every joint of the open command to the same values.
+   */
+  void setAllJoints(double kp, double kd, double targetPos, double targetVel, double targetTorque);
+
+  /**
+   * @brief Validates the open command once, clamps it when joint safety is
+   *        enabled and publishes it once, also capturing it when the flight
+   *        recorder runs.
+   *
+   * @return False, without publishing, if no command is open or any value is
+   *         non-finite or a gain is negative.
+   */
+  bool commitCommand();
+
   /**
    * @brief Function to control a single joint of the robot.
    *
+   * Inside an open command this only sets the joint; otherwise it publishes
+   * a command of its own, so prefer one transaction when driving several joints.
+   *
    * @param jointId The ID of the joint to control.
    * @param kp Proportional gain for the PID controller.
    * @param kd Derivative gain for the PID controller.
@@ -78,14 +144,22 @@ protected:
 
   std::mutex mtx_;             // Mutex for thread safety
 
-  limxsdk::PointFoot *pf_;     // Pointer to the PointFoot instance
+  limxsdk::ApiBase *pf_;       // Pointer to the robot instance (PointFoot unless another backend is given)
   limxsdk::RobotCmd robot_cmd_;// Robot command object
   limxsdk::RobotState robot_state_; // Robot state object
   limxsdk::ImuData imu_data_; // Imu data object
+  limxsdk::ability::DiagnosticDispatcher diagnostics_; // Routes diagnostics by interned name
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+  limxsdk::rl::JointSafety joint_safety_; // Last stage before publishing, empty while disabled
+#endif
 
   bool robotstate_on_;         // Flag indicating if robot state is received
   bool is_first_enter_{true};  // Flag indicating the first iteration
   double time_start_{0.0};     // Start time for an action
   double time_action_ = 3.0;   // Duration of an action
   int running_iter_{1};        // Iteration count
+
+private:
+  bool command_open_{false};   // Between beginCommand() and commitCommand()
+  std::unique_ptr<limxsdk::ability::FlightRecorder> recorder_; // Optional flight recorder
 };
@@ -9,6 +9,7 @@
  */
 
 #include "pf_controller_base.h" // Include header file for PFControllerBase class
+#include "limxsdk/trajectory/joint_trajectory.h" // Include for limxsdk::trajectory::JointTrajectory
 
 // Class for controlling movement of multiple joints simultaneously inheriting from PFControllerBase
 class PFGroupJointMove : public PFControllerBase
@@ -20,14 +21,12 @@ public:
   void init()
   {
     // Subscribing to diagnostic values for calibration state
-    pf_->subscribeDiagnosticValue([&](const limxsdk::DiagnosticValueConstPtr& msg) {
-      // Check if the diagnostic message pertains to calibration
-      if (msg->name == "calibration") {
-        if (msg->code != 0){
-          abort();
-        }
+    diagnostics_.subscribe("calibration", [&](uint32_t, const limxsdk::DiagnosticValue& msg) {
+      if (msg.code != 0){
+        abort();
       }
     });
+    diagnostics_.attach(pf_);
     
     // Set default values for gains, target positions, velocities, and torques
     kp.resize(pf_->getMotorNumber(), 60.0);
@@ -36,6 +35,7 @@ public:
     targetVel.resize(pf_->getMotorNumber(), 0.0);
     targetTorque.resize(pf_->getMotorNumber(), 0.0);
     init_pos_.resize(pf_->getMotorNumber(), 0.0);
+    jointPos_.resize(pf_->getMotorNumber(), 0.0);
     robotstate_on_ = false; // Initialize robot state flag
   }
 
@@ -51,28 +51,31 @@ public:
       if (robotstate_on_)
       {
         auto time_point = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
-        std::vector<float> jointPos{6, 0.0}; // Vector to store desired joint positions
-        double r = 0.0;                       // Variable to calculate interpolation ratio
 
-        // If it's the first iteration, initialize the joint positions
+        // If it's the first iteration, plan a synchronized minimum-jerk move from the current positions
         if (is_first_enter_)
         {
           init_pos_ = robot_state_.q;
+          limxsdk::trajectory::TrajectoryRequest request;
+          request.profile = limxsdk::trajectory::Profile::MIN_JERK;
+          request.start = init_pos_;
+          request.goal = targetPos;
+          request.maxVelocity.assign(init_pos_.size(), max_velocity_);
+          request.maxAcceleration.assign(init_pos_.size(), max_acceleration_);
+          request.minDuration = 2.0; // At least the 2000 iterations of the former linear blend
+          if (!trajectory_.plan(request))
+          {
+            abort();
+          }
           is_first_enter_ = false;
-          std::cout << "Received\n";
+          std::cout << "Received, moving for " << trajectory_.duration() << " s\n";
         }
 
-        // Calculate the interpolation ratio
-        r = std::min(std::max(double(running_iter_) / 2000.0, 0.0), 1.0);
-
-        // Calculate the desired joint positions using linear interpolation
-        for (size_t i = 0; i < pf_->getMotorNumber(); ++i)
-        {
-          jointPos[i] = (1 - r) * init_pos_[i] + r * targetPos[i];
-        }
+        // Desired joint positions at this iteration (1 ms each)
+        trajectory_.evaluate(running_iter_ * 0.001, jointPos_.data());
 
         // Control the joints using PID controllers
-        groupJointController(kp, kd, jointPos, targetVel, targetTorque);
+        groupJointController(kp, kd, jointPos_, targetVel, targetTorque);
 
         std::this_thread::sleep_until(time_point); // Sleep until the next iteration
 
@@ -92,6 +95,10 @@ public:
 private:
   std::vector<float> kp, kd, targetPos, targetVel, targetTorque; // Gains and targets
   std::vector<float> init_pos_;                                  // Initial joint positions
+  std::vector<float> jointPos_;                                  // Desired joint positions of this iteration
+  limxsdk::trajectory::JointTrajectory trajectory_;              // Move from init_pos_ to targetPos
+  float max_velocity_ = 1.0f;                                    // Joint velocity limit of the move (rad/s)
+  float max_acceleration_ = 5.0f;                                // Joint acceleration limit of the move (rad/s^2)
   bool is_first_enter_{true};                                    // Flag for first iteration
   int running_iter_{1};                                          // Iteration count
 };
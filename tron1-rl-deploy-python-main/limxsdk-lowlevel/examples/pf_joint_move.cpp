@@ -9,6 +9,7 @@
  */
 
 #include "pf_controller_base.h" // Include header file for PFControllerBase class
+#include "limxsdk/trajectory/joint_trajectory.h" // Include for limxsdk::trajectory::JointTrajectory
 
 // Class for controlling single-joint movement inheriting from PFControllerBase
 class PFJointMove : public PFControllerBase
@@ -20,14 +21,12 @@ public:
   void init()
   {
     // Subscribing to diagnostic values for calibration state
-    pf_->subscribeDiagnosticValue([&](const limxsdk::DiagnosticValueConstPtr& msg) {
-      // Check if the diagnostic message pertains to calibration
-      if (msg->name == "calibration") {
-        if (msg->code != 0){
-          abort();
-        }
+    diagnostics_.subscribe("calibration", [&](uint32_t, const limxsdk::DiagnosticValue& msg) {
+      if (msg.code != 0){
+        abort();
       }
     });
+    diagnostics_.attach(pf_);
   }
 
   /**
@@ -42,22 +41,29 @@ public:
       if (robotstate_on_)
       {
         auto time_point = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
-        double jointPos = 0; // Variable to store the desired joint position
-        double r = 0.0;       // Variable to calculate interpolation ratio
+        float jointPos = 0; // Variable to store the desired joint position
 
-        // If it's the first iteration, initialize the joint position
+        // If it's the first iteration, plan a minimum-jerk move from the current position
         if (is_first_enter_)
         {
           joint_init_pos_ = robot_state_.q[joint_id];
+          limxsdk::trajectory::TrajectoryRequest request;
+          request.profile = limxsdk::trajectory::Profile::MIN_JERK;
+          request.start.assign(1, joint_init_pos_);
+          request.goal.assign(1, joint_targetPos);
+          request.maxVelocity.assign(1, joint_max_velocity);
+          request.maxAcceleration.assign(1, joint_max_acceleration);
+          request.minDuration = 2.0; // At least the 2000 iterations of the former linear blend
+          if (!trajectory_.plan(request))
+          {
+            abort();
+          }
           is_first_enter_ = false;
-          std::cout << "Received\n";
+          std::cout << "Received, moving for " << trajectory_.duration() << " s\n";
         }
 
-        // Calculate the interpolation ratio
-        r = std::min(std::max(double(running_iter_) / 2000.0, 0.0), 1.0);
-
-        // Calculate the desired joint position using linear interpolation
-        jointPos = (1 - r) * joint_init_pos_ + r * joint_targetPos;
+        // Desired joint position at this iteration (1 ms each)
+        trajectory_.evaluate(running_iter_ * 0.001, &jointPos);
 
         // Control the joint using a PID controller
         singleJointController(joint_id, joint_kp, joint_kd, jointPos, joint_targetVel, joint_targetTorque);
@@ -85,7 +91,11 @@ private:
   double joint_targetVel = 0;       // Target velocity for the joint (not used in this implementation)
   double joint_targetTorque = 0;    // Target torque for the joint (not used in this implementation)
 
+  float joint_max_velocity = 1.0f;      // Velocity limit of the move (rad/s)
+  float joint_max_acceleration = 5.0f;  // Acceleration limit of the move (rad/s^2)
+
   double joint_init_pos_ = 0;       // Initial position of the joint
+  limxsdk::trajectory::JointTrajectory trajectory_; // Move from joint_init_pos_ to joint_targetPos
   bool is_first_enter_{true};       // Flag to indicate the first iteration
   int running_iter_{1};              // Iteration count
 };
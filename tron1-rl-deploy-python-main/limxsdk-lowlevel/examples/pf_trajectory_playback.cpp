@@ -0,0 +1,296 @@
+/**
+ * @file pf_trajectory_playback.cpp
+ * @brief Plays a recorded or offline-optimized joint trajectory file on the robot.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   pf_trajectory_playback <trajectory.ltrj> [robot_ip] [--rate R] [--record DIR]
+ *                          [--model-dir DIR --robot-type TYPE]
+ *
+ * --record DIR captures the robot streams and every command with the flight
+ * recorder. --robot-type clamps every command to the joint_limits and torque
+ * limits of <model-dir>/<TYPE>/params.yaml (needs a build with yaml-cpp).
+ *
+ * The robot first moves to the first keyframe with a minimum-jerk move,
+ * then follows the file at 1 kHz. Commands on stdin, one per line:
+ *   p          pause or resume
+ *   s <sec>    seek; the robot moves to the new position before playing on
+ *   r <rate>   playback speed, 1 is real time, negative plays backwards
+ *   q          damp all joints and quit
+ * Trajectory files are written with limxsdk::trajectory::TrajectoryFileWriter,
+ * e.g. by trajectory_from_flight_log.
+ */
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <string>
+#include "pf_controller_base.h" // Include header file for PFControllerBase class
+#include "limxsdk/trajectory/joint_trajectory.h" // Include for limxsdk::trajectory::JointTrajectory
+#include "limxsdk/trajectory/trajectory_player.h" // Include for limxsdk::trajectory::TrajectoryPlayer
+
+// Class playing a trajectory file through PFControllerBase
+class PFTrajectoryPlayback : public PFControllerBase
+{
+public:
+  /**
+   * @brief Initialize the controller.
+   * @return False if the file cannot be played on this robot.
+   */
+  bool init(const std::string &path, double rate)
+  {
+    // Subscribing to diagnostic values for calibration state
+    diagnostics_.subscribe("calibration", [&](uint32_t, const limxsdk::DiagnosticValue& msg) {
+      if (msg.code != 0){
+        abort();
+      }
+    });
+    diagnostics_.attach(pf_);
+
+    if (!player_.open(path))
+    {
+      return false;
+    }
+    if (player_.joints() != pf_->getMotorNumber())
+    {
+      std::cerr << path << ": " << player_.joints() << " joints, the robot has " << pf_->getMotorNumber() << std::endl;
+      return false;
+    }
+    player_.setRate(rate);
+    jointPos_.resize(player_.joints(), 0.0f);
+    jointVel_.resize(player_.joints(), 0.0f);
+    targetPos_.resize(player_.joints(), 0.0f);
+    std::cout << path << ": " << player_.keyframes() << " keyframes, " << player_.duration() << " s\n";
+    return true;
+  }
+
+  /**
+   * @brief Reads playback commands from stdin until "q" or the end of input.
+   */
+  void commandLoop()
+  {
+    std::string line;
+    while (!quit_ && std::getline(std::cin, line))
+    {
+      std::istringstream in(line);
+      std::string command;
+      double value = 0.0;
+      in >> command;
+      if (command == "p")
+      {
+        player_.pauseRequested() ? player_.resume() : player_.pause();
+      }
+      else if (command == "s" && in >> value)
+      {
+        seek_target_ = value;
+      }
+      else if (command == "r" && in >> value)
+      {
+        player_.setRate(value);
+      }
+      else if (command == "q")
+      {
+        quit_ = true;
+      }
+      else if (!command.empty())
+      {
+        std::cout << "Commands: p | s <sec> | r <rate> | q\n";
+      }
+    }
+  }
+
+  /**
+   * @brief Start the control loop; returns after "q".
+   */
+  void starting()
+  {
+    std::cout << "Waiting to receive data...\n";
+
+    while (!quit_)
+    {
+      if (robotstate_on_)
+      {
+        auto time_point = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+
+        // Start from the measured positions, then from the last command after a seek
+        if (is_first_enter_)
+        {
+          mtx_.lock();
+          std::copy(robot_state_.q.begin(), robot_state_.q.end(), jointPos_.begin());
+          mtx_.unlock();
+          planTransition();
+          is_first_enter_ = false;
+        }
+        const double seek = seek_target_.exchange(NO_SEEK);
+        if (!std::isnan(seek))
+        {
+          player_.seek(seek);
+          planTransition();
+        }
+
+        if (in_transition_)
+        {
+          transition_.evaluate(transition_iter_++ * 0.001, jointPos_.data());
+          std::fill(jointVel_.begin(), jointVel_.end(), 0.0f);
+          in_transition_ = transition_iter_ * 0.001 < transition_.duration();
+        }
+        else
+        {
+          player_.advance(0.001);
+          player_.sample(jointPos_.data(), jointVel_.data());
+        }
+
+        beginCommand();
+        for (size_t j = 0; j < jointPos_.size(); ++j)
+        {
+          setJoint(j, kp_, kd_, jointPos_[j], jointVel_[j], 0.0);
+        }
+        commitCommand();
+
+        std::this_thread::sleep_until(time_point); // Sleep until the next iteration
+        robotstate_on_ = false; // Reset the flag for receiving robot state data
+      }
+      else
+      {
+        usleep(1); // Sleep for a short duration if robot state data is not received
+      }
+    }
+    damping();
+  }
+
+private:
+  /**
+   * @brief Plans the move from the current targets to the playhead of the player.
+   */
+  void planTransition()
+  {
+    player_.advance(0.0);
+    player_.sample(targetPos_.data());
+    limxsdk::trajectory::TrajectoryRequest request;
+    request.profile = limxsdk::trajectory::Profile::MIN_JERK;
+    request.start = jointPos_;
+    request.goal = targetPos_;
+    request.maxVelocity.assign(jointPos_.size(), max_velocity_);
+    request.maxAcceleration.assign(jointPos_.size(), max_acceleration_);
+    if (!transition_.plan(request))
+    {
+      abort();
+    }
+    transition_iter_ = 1;
+    in_transition_ = true;
+    std::cout << "Moving to " << player_.time() << " s of the trajectory for " << transition_.duration() << " s\n";
+  }
+
+  static constexpr double NO_SEEK = std::numeric_limits<double>::quiet_NaN();
+
+  limxsdk::trajectory::TrajectoryPlayer player_;      // Mapped trajectory file and its playhead
+  limxsdk::trajectory::JointTrajectory transition_;   // Move to the playhead at start and after a seek
+  std::vector<float> jointPos_;                       // Position targets of this iteration
+  std::vector<float> jointVel_;                       // Velocity targets of this iteration
+  std::vector<float> targetPos_;                      // Trajectory position at the playhead
+  double kp_ = 60.0;                                  // Proportional gain of every joint
+  double kd_ = 3.0;                                   // Derivative gain of every joint
+  float max_velocity_ = 1.0f;                         // Joint velocity limit of transitions (rad/s)
+  float max_acceleration_ = 5.0f;                     // Joint acceleration limit of transitions (rad/s^2)
+  bool in_transition_{false};                         // Following transition_ instead of the player
+  int transition_iter_{1};                            // Iteration count of the transition
+  std::atomic<double> seek_target_{NO_SEEK};          // Seek requested on stdin, NaN if none
+  std::atomic<bool> quit_{false};                     // Set by "q"
+};
+
+constexpr double PFTrajectoryPlayback::NO_SEEK;
+
+/**
+ * @brief Main function.
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return Integer indicating the exit status.
+ */
+int main(int argc, char *argv[])
+{
+  std::string path;
+  std::string robot_ip = "127.0.0.1"; // Default robot IP address
+  double rate = 1.0;
+  limxsdk::ability::FlightRecorderConfig recorder; // Disabled while directory is empty
+  std::string model_dir;
+  std::string robot_type; // Joint limits of <model_dir>/<robot_type>/params.yaml, unclamped while empty
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--rate" && i + 1 < argc)
+    {
+      rate = std::atof(argv[++i]);
+    }
+    else if (arg == "--record" && i + 1 < argc)
+    {
+      recorder.directory = argv[++i];
+    }
+    else if (arg == "--model-dir" && i + 1 < argc)
+    {
+      model_dir = argv[++i];
+    }
+    else if (arg == "--robot-type" && i + 1 < argc)
+    {
+      robot_type = argv[++i];
+    }
+    else if (path.empty())
+    {
+      path = arg;
+    }
+    else
+    {
+      robot_ip = arg;
+    }
+  }
+  if (path.empty())
+  {
+    std::cout << "Usage: pf_trajectory_playback <trajectory.ltrj> [robot_ip] [--rate R] [--record DIR]\n"
+              "       [--model-dir DIR --robot-type TYPE]\n";
+    return 1;
+  }
+
+  limxsdk::PointFoot *pf = limxsdk::PointFoot::getInstance(); // Obtain instance of PointFoot class
+
+  // Initialize the robot
+  if (!pf->init(robot_ip))
+  {
+    exit(1); // Exit program if initialization fails
+  }
+
+  PFTrajectoryPlayback ctrl; // Create an instance of PFTrajectoryPlayback controller
+  if (!ctrl.init(path, rate))
+  {
+    return 1;
+  }
+  if (!recorder.directory.empty() && !ctrl.startFlightRecorder(recorder))
+  {
+    return 1;
+  }
+  if (!robot_type.empty())
+  {
+#ifdef LIMX_SDK_WITH_JOINT_SAFETY
+    limxsdk::rl::PolicyConfig config;
+    if (!config.load(model_dir.empty() ? "." : model_dir, robot_type, "isaacgym") || !ctrl.enableJointSafety(config))
+    {
+      return 1;
+    }
+#else
+    std::cerr << "Built without yaml-cpp, --robot-type is not supported" << std::endl;
+    return 1;
+#endif
+  }
+  std::thread commands(&PFTrajectoryPlayback::commandLoop, &ctrl);
+  commands.detach(); // std::getline cannot be interrupted; the thread ends with the process
+  ctrl.starting();   // Run the control loop until "q"
+
+#ifdef WIN32
+  timeEndPeriod(1);
+#endif
+
+  return 0; // Return 0 to indicate successful execution
+}
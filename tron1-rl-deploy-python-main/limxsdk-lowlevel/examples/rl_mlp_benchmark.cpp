@@ -0,0 +1,224 @@
+/**
+ * @file rl_mlp_benchmark.cpp
+ * @brief Times the native MLP engine per kernel (and ONNX Runtime when compiled in) on policy models.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   rl_mlp_benchmark [--iterations N] [--kernel NAME] [--precision fp32,fp16,int8] [--tolerance T] model.onnx...
+ *
+ * If <model>.onnx.ref exists (see python3/examples/rl/export_reference.py),
+ * every kernel is also checked against the ONNX Runtime outputs stored in it:
+ * |native - reference| must not exceed T * (1 + |reference|). The exit code
+ * is non-zero if any fp32 check fails; fp16/int8 errors are only reported,
+ * their gate is rl_quantize_calibrate.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "limxsdk/rl/mlp_session.h"
+#include "limxsdk/rl/session_factory.h"
+
+using namespace limxsdk::rl;
+
+namespace
+{
+  struct Reference
+  {
+    uint32_t count = 0;
+    uint32_t in = 0;
+    uint32_t out = 0;
+    std::vector<float> inputs;
+    std::vector<float> outputs;
+  };
+
+  bool loadReference(const std::string &path, Reference &ref)
+  {
+    std::ifstream file(path, std::ios::binary);
+    uint32_t header[5];
+    if (!file || !file.read(reinterpret_cast<char *>(header), sizeof(header)) || header[0] != 0x4645524C ||
+        header[1] != 1)
+    {
+      return false;
+    }
+    ref.count = header[2];
+    ref.in = header[3];
+    ref.out = header[4];
+    ref.inputs.resize(static_cast<size_t>(ref.count) * ref.in);
+    ref.outputs.resize(static_cast<size_t>(ref.count) * ref.out);
+    return static_cast<bool>(file.read(reinterpret_cast<char *>(ref.inputs.data()), ref.inputs.size() * sizeof(float)) &&
+                             file.read(reinterpret_cast<char *>(ref.outputs.data()), ref.outputs.size() * sizeof(float)));
+  }
+
+  /**
+   * @brief Largest |y - ref| / (1 + |ref|) over all reference samples.
+   */
+  double referenceError(InferenceSession &session, const Reference &ref)
+  {
+    std::vector<float> output(ref.out);
+    double worst = 0.0;
+    for (uint32_t s = 0; s < ref.count; ++s)
+    {
+      session.run(&ref.inputs[static_cast<size_t>(s) * ref.in], output.data());
+      for (uint32_t o = 0; o < ref.out; ++o)
+      {
+        const double expected = ref.outputs[static_cast<size_t>(s) * ref.out + o];
+        worst = std::max(worst, std::fabs(output[o] - expected) / (1.0 + std::fabs(expected)));
+      }
+    }
+    return worst;
+  }
+
+  struct Timing
+  {
+    double mean_ns;
+    double p50_ns;
+    double p99_ns;
+  };
+
+  Timing measure(InferenceSession &session, int iterations)
+  {
+    std::mt19937 rng(1);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::vector<float> input(session.inputSize());
+    std::vector<float> output(session.outputSize());
+    for (auto &v : input)
+    {
+      v = normal(rng);
+    }
+    for (int i = 0; i < std::min(iterations, 1000); ++i)
+    {
+      session.run(input.data(), output.data());
+    }
+
+    std::vector<double> samples(iterations);
+    double total = 0.0;
+    for (int i = 0; i < iterations; ++i)
+    {
+      input[i % input.size()] = normal(rng);
+      const auto start = std::chrono::steady_clock::now();
+      session.run(input.data(), output.data());
+      samples[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      total += samples[i];
+    }
+    std::sort(samples.begin(), samples.end());
+    Timing timing;
+    timing.mean_ns = total / iterations;
+    timing.p50_ns = samples[iterations / 2];
+    timing.p99_ns = samples[std::min(iterations - 1, iterations * 99 / 100)];
+    return timing;
+  }
+
+  void usage()
+  {
+    std::printf("Usage: rl_mlp_benchmark [--iterations N] [--kernel NAME] [--precision fp32,fp16,int8] "
+                "[--tolerance T] model.onnx...\n");
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  int iterations = 20000;
+  double tolerance = 1e-4;
+  std::string kernel;
+  std::string precisions = "fp32";
+  std::vector<std::string> models;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    if (arg == "--iterations" && i + 1 < argc)
+    {
+      iterations = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--kernel" && i + 1 < argc)
+    {
+      kernel = argv[++i];
+    }
+    else if (arg == "--precision" && i + 1 < argc)
+    {
+      precisions = argv[++i];
+    }
+    else if (arg == "--tolerance" && i + 1 < argc)
+    {
+      tolerance = std::atof(argv[++i]);
+    }
+    else if (arg == "-h" || arg == "--help")
+    {
+      usage();
+      return 0;
+    }
+    else
+    {
+      models.push_back(arg);
+    }
+  }
+  if (models.empty())
+  {
+    usage();
+    return 1;
+  }
+
+  std::vector<std::string> backends;
+  for (const auto &k : mlp_kernels::available())
+  {
+    if (kernel.empty() || kernel == k.name)
+    {
+      std::stringstream list(precisions);
+      std::string precision;
+      while (std::getline(list, precision, ','))
+      {
+        backends.push_back(std::string("native:") + k.name + (precision == "fp32" ? "" : ":" + precision));
+      }
+    }
+  }
+#ifdef LIMX_SDK_WITH_ONNXRUNTIME
+  backends.push_back("onnxruntime");
+#endif
+
+  bool passed = true;
+  std::printf("%-21s %-10s %8s %10s %10s %10s %10s\n", "backend", "shape", "", "mean[us]", "p50[us]", "p99[us]",
+              "ref err");
+  for (const auto &model : models)
+  {
+    std::printf("%s\n", model.c_str());
+    Reference ref;
+    const bool has_ref = loadReference(model + ".ref", ref);
+    for (const auto &backend : backends)
+    {
+      std::unique_ptr<InferenceSession> session = loadInferenceSession(backend, model);
+      if (!session)
+      {
+        passed = false;
+        continue;
+      }
+      const Timing timing = measure(*session, iterations);
+      char shape[32];
+      std::snprintf(shape, sizeof(shape), "%zu->%zu", session->inputSize(), session->outputSize());
+      char error[32] = "-";
+      if (has_ref && ref.in == session->inputSize() && ref.out == session->outputSize())
+      {
+        const double err = referenceError(*session, ref);
+        const bool gated = backend.find("fp16") == std::string::npos && backend.find("int8") == std::string::npos;
+        const bool ok = !gated || err <= tolerance;
+        passed = passed && ok;
+        std::snprintf(error, sizeof(error), "%.2e%s", err, !gated ? "" : ok ? " ok" : " FAIL");
+      }
+      std::printf("%-21s %-10s %8s %10.2f %10.2f %10.2f %10s\n", backend.c_str(), shape, "", timing.mean_ns / 1e3,
+                  timing.p50_ns / 1e3, timing.p99_ns / 1e3, error);
+    }
+  }
+  return passed ? 0 : 2;
+}
@@ -0,0 +1,491 @@
+/**
+ * @file rl_model_suite.cpp
+ * @brief Checks and times every bundled RL model pair under a model directory.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   rl_model_suite [--model-dir DIR] [--backend LIST] [--iterations N] [--cold-runs N]
+ *                  [--csv FILE] [--json FILE]
+ *
+ * Every <DIR>/<ROBOT_TYPE>/params.yaml with policy/<rl_type>/encoder.onnx
+ * and policy.onnx (rl_type isaacgym or isaaclab) is loaded. The graph
+ * shapes are checked against params.yaml:
+ *   encoder input  = history * observations_size, where a history other than
+ *                    obs_history_length is only warned about, as in
+ *                    LocomotionController
+ *   encoder output = encoder_output_size
+ *   policy input   = encoder_output_size + observations_size + commands
+ *   policy output  = actions_size
+ * Then each backend (all native kernels, plus onnxruntime when compiled in;
+ * --backend takes a comma separated list instead) is timed on one
+ * encoder + policy step with standard normal inputs:
+ *   cold: first step of freshly loaded sessions, --cold-runs times (default 5)
+ *   warm: --iterations steps (default 2000) after as many warm-up steps
+ *
+ * One row per model pair and backend goes to the CSV and JSON files ("-"
+ * for stdout); a summary is printed. The exit code is non-zero if any
+ * model fails to load or any shape check fails.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "limxsdk/rl/mlp_kernels.h"
+#include "limxsdk/rl/policy_config.h"
+#include "limxsdk/rl/session_factory.h"
+
+using namespace limxsdk::rl;
+
+namespace
+{
+  struct Percentiles
+  {
+    double mean_us = 0.0;
+    double p50_us = 0.0;
+    double p90_us = 0.0;
+    double p99_us = 0.0;
+    double max_us = 0.0;
+  };
+
+  /**
+   * @brief One model pair on one backend.
+   */
+  struct Result
+  {
+    std::string robot_type;
+    std::string rl_type;
+    std::string backend;
+    size_t encoder_in = 0;
+    size_t encoder_out = 0;
+    size_t policy_in = 0;
+    size_t policy_out = 0;
+    std::string check = "ok";   // Shape mismatches, "; " separated
+    std::string error;          // Load failure; no timings then
+    Percentiles cold;
+    Percentiles warm;
+  };
+
+  Percentiles percentiles(std::vector<double> samples_ns)
+  {
+    Percentiles p;
+    if (samples_ns.empty())
+    {
+      return p;
+    }
+    std::sort(samples_ns.begin(), samples_ns.end());
+    double sum = 0.0;
+    for (double s : samples_ns)
+    {
+      sum += s;
+    }
+    const size_t n = samples_ns.size();
+    p.mean_us = sum / n / 1e3;
+    p.p50_us = samples_ns[n / 2] / 1e3;
+    p.p90_us = samples_ns[std::min(n - 1, n * 90 / 100)] / 1e3;
+    p.p99_us = samples_ns[std::min(n - 1, n * 99 / 100)] / 1e3;
+    p.max_us = samples_ns.back() / 1e3;
+    return p;
+  }
+
+  /**
+   * @brief Encoder followed by policy on preallocated buffers, as LocomotionController runs them.
+   */
+  struct Step
+  {
+    std::unique_ptr<InferenceSession> encoder;
+    std::unique_ptr<InferenceSession> policy;
+    std::vector<float> history;
+    std::vector<float> policy_input;
+    std::vector<float> actions;
+
+    bool load(const std::string &backend, const PolicyConfig &config)
+    {
+      encoder = loadInferenceSession(backend, config.encoderPath);
+      policy = loadInferenceSession(backend, config.policyPath);
+      if (!encoder || !policy || policy->inputSize() < encoder->outputSize())
+      {
+        return false;
+      }
+      std::mt19937 rng(1);
+      std::normal_distribution<float> normal(0.0f, 1.0f);
+      history.resize(encoder->inputSize());
+      policy_input.resize(policy->inputSize());
+      actions.resize(policy->outputSize());
+      for (auto &v : history)
+      {
+        v = normal(rng);
+      }
+      for (auto &v : policy_input)
+      {
+        v = normal(rng);
+      }
+      return true;
+    }
+
+    int64_t run()
+    {
+      const auto start = std::chrono::steady_clock::now();
+      encoder->run(history.data(), policy_input.data());
+      policy->run(policy_input.data(), actions.data());
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+  };
+
+  void checkShapes(const PolicyConfig &config, bool warn, Result &result)
+  {
+    std::vector<std::string> issues;
+    std::ostringstream out;
+    // The controllers size the history by the encoder input, see LocomotionController::init()
+    const size_t obs = static_cast<size_t>(config.observationsSize);
+    const size_t history = static_cast<size_t>(config.historyLength) * obs;
+    if (result.encoder_in < obs || result.encoder_in % obs != 0)
+    {
+      out.str("");
+      out << "encoder input " << result.encoder_in << " is not a whole number of observations_size " << obs;
+      issues.push_back(out.str());
+    }
+    else if (result.encoder_in != history && warn)
+    {
+      std::cerr << "Warning: " << config.encoderPath << " takes " << result.encoder_in / obs
+                << " observations but obs_history_length is " << config.historyLength << std::endl;
+    }
+    if (result.encoder_out != static_cast<size_t>(config.encoderOutputSize))
+    {
+      out.str("");
+      out << "encoder output " << result.encoder_out << " != encoder_output_size " << config.encoderOutputSize;
+      issues.push_back(out.str());
+    }
+    const size_t policy_in = config.encoderOutputSize + config.observationsSize + config.policyCommandsSize();
+    if (result.policy_in != policy_in)
+    {
+      out.str("");
+      out << "policy input " << result.policy_in << " != latent + observations + commands " << policy_in;
+      issues.push_back(out.str());
+    }
+    if (result.policy_out != static_cast<size_t>(config.actionsSize))
+    {
+      out.str("");
+      out << "policy output " << result.policy_out << " != actions_size " << config.actionsSize;
+      issues.push_back(out.str());
+    }
+    if (!issues.empty())
+    {
+      result.check.clear();
+      for (size_t i = 0; i < issues.size(); ++i)
+      {
+        result.check += (i ? "; " : "") + issues[i];
+      }
+    }
+  }
+
+  void measure(const std::string &backend, const PolicyConfig &config, int iterations, int cold_runs, Result &result)
+  {
+    std::vector<double> cold;
+    for (int r = 0; r < cold_runs; ++r)
+    {
+      Step step;
+      if (!step.load(backend, config))
+      {
+        result.error = "cannot load with " + backend;
+        return;
+      }
+      if (r == 0)
+      {
+        result.encoder_in = step.encoder->inputSize();
+        result.encoder_out = step.encoder->outputSize();
+        result.policy_in = step.policy->inputSize();
+        result.policy_out = step.policy->outputSize();
+      }
+      cold.push_back(static_cast<double>(step.run()));
+    }
+    result.cold = percentiles(cold);
+
+    Step step;
+    if (!step.load(backend, config))
+    {
+      result.error = "cannot load with " + backend;
+      return;
+    }
+    for (int i = 0; i < iterations; ++i)
+    {
+      step.run();
+    }
+    std::vector<double> warm(iterations);
+    for (int i = 0; i < iterations; ++i)
+    {
+      warm[i] = static_cast<double>(step.run());
+    }
+    result.warm = percentiles(warm);
+  }
+
+  std::vector<std::string> listRobotTypes(const std::string &model_dir)
+  {
+    std::vector<std::string> types;
+    DIR *dir = opendir(model_dir.c_str());
+    if (!dir)
+    {
+      return types;
+    }
+    while (dirent *entry = readdir(dir))
+    {
+      const std::string name = entry->d_name;
+      if (name[0] != '.' && std::ifstream(model_dir + "/" + name + "/params.yaml"))
+      {
+        types.push_back(name);
+      }
+    }
+    closedir(dir);
+    std::sort(types.begin(), types.end());
+    return types;
+  }
+
+  std::string csvField(const std::string &value)
+  {
+    if (value.find_first_of(",\"") == std::string::npos)
+    {
+      return value;
+    }
+    std::string quoted = "\"";
+    for (char c : value)
+    {
+      quoted += c == '"' ? "\"\"" : std::string(1, c);
+    }
+    return quoted + "\"";
+  }
+
+  std::string jsonString(const std::string &value)
+  {
+    std::string quoted = "\"";
+    for (char c : value)
+    {
+      if (c == '"' || c == '\\')
+      {
+        quoted += '\\';
+      }
+      quoted += c;
+    }
+    return quoted + "\"";
+  }
+
+  void writeCsv(std::ostream &out, const std::vector<Result> &results)
+  {
+    out << "robot_type,rl_type,backend,encoder_in,encoder_out,policy_in,policy_out,check,error,"
+           "cold_mean_us,cold_p50_us,cold_max_us,warm_mean_us,warm_p50_us,warm_p90_us,warm_p99_us,warm_max_us\n";
+    char numbers[256];
+    for (const auto &r : results)
+    {
+      std::snprintf(numbers, sizeof(numbers), "%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f", r.cold.mean_us,
+                    r.cold.p50_us, r.cold.max_us, r.warm.mean_us, r.warm.p50_us, r.warm.p90_us, r.warm.p99_us,
+                    r.warm.max_us);
+      out << r.robot_type << "," << r.rl_type << "," << r.backend << "," << r.encoder_in << "," << r.encoder_out
+          << "," << r.policy_in << "," << r.policy_out << "," << csvField(r.check) << "," << csvField(r.error) << ","
+          << numbers << "\n";
+    }
+  }
+
+  void writeJsonPercentiles(std::ostream &out, const char *name, const Percentiles &p, bool warm)
+  {
+    char buffer[256];
+    if (warm)
+    {
+      std::snprintf(buffer, sizeof(buffer),
+                    "\"%s\": {\"mean_us\": %.2f, \"p50_us\": %.2f, \"p90_us\": %.2f, \"p99_us\": %.2f, "
+                    "\"max_us\": %.2f}",
+                    name, p.mean_us, p.p50_us, p.p90_us, p.p99_us, p.max_us);
+    }
+    else
+    {
+      std::snprintf(buffer, sizeof(buffer), "\"%s\": {\"mean_us\": %.2f, \"p50_us\": %.2f, \"max_us\": %.2f}", name,
+                    p.mean_us, p.p50_us, p.max_us);
+    }
+    out << buffer;
+  }
+
+  void writeJson(std::ostream &out, const std::vector<Result> &results)
+  {
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+      const Result &r = results[i];
+      out << "  {\"robot_type\": " << jsonString(r.robot_type) << ", \"rl_type\": " << jsonString(r.rl_type)
+          << ", \"backend\": " << jsonString(r.backend) << ",\n   \"encoder\": [" << r.encoder_in << ", "
+          << r.encoder_out << "], \"policy\": [" << r.policy_in << ", " << r.policy_out
+          << "], \"check\": " << jsonString(r.check) << ", \"error\": " << jsonString(r.error) << ",\n   ";
+      writeJsonPercentiles(out, "cold", r.cold, false);
+      out << ", ";
+      writeJsonPercentiles(out, "warm", r.warm, true);
+      out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+  }
+
+  bool writeFile(const std::string &path, const std::vector<Result> &results, bool json)
+  {
+    if (path == "-")
+    {
+      json ? writeJson(std::cout, results) : writeCsv(std::cout, results);
+      return true;
+    }
+    std::ofstream out(path);
+    if (!out)
+    {
+      std::cerr << "Cannot write " << path << std::endl;
+      return false;
+    }
+    json ? writeJson(out, results) : writeCsv(out, results);
+    return static_cast<bool>(out);
+  }
+
+  void usage()
+  {
+    std::printf("Usage: rl_model_suite [--model-dir DIR] [--backend LIST] [--iterations N] [--cold-runs N]\n"
+                "                      [--csv FILE] [--json FILE]\n");
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  std::string model_dir = "controllers/model";
+  std::string backend_list;
+  std::string csv_path = "rl_model_suite.csv";
+  std::string json_path = "rl_model_suite.json";
+  int iterations = 2000;
+  int cold_runs = 5;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--model-dir" && has_value)
+    {
+      model_dir = argv[++i];
+    }
+    else if (arg == "--backend" && has_value)
+    {
+      backend_list = argv[++i];
+    }
+    else if (arg == "--iterations" && has_value)
+    {
+      iterations = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--cold-runs" && has_value)
+    {
+      cold_runs = std::max(1, std::atoi(argv[++i]));
+    }
+    else if (arg == "--csv" && has_value)
+    {
+      csv_path = argv[++i];
+    }
+    else if (arg == "--json" && has_value)
+    {
+      json_path = argv[++i];
+    }
+    else
+    {
+      usage();
+      return arg == "-h" || arg == "--help" ? 0 : 1;
+    }
+  }
+
+  std::vector<std::string> backends;
+  if (backend_list.empty())
+  {
+    for (const auto &kernel : mlp_kernels::available())
+    {
+      backends.push_back(std::string("native:") + kernel.name);
+    }
+#ifdef LIMX_SDK_WITH_ONNXRUNTIME
+    backends.push_back("onnxruntime");
+#endif
+  }
+  else
+  {
+    std::stringstream list(backend_list);
+    std::string name;
+    while (std::getline(list, name, ','))
+    {
+      backends.push_back(name);
+    }
+  }
+
+  const std::vector<std::string> robot_types = listRobotTypes(model_dir);
+  if (robot_types.empty())
+  {
+    std::cerr << "No <robot type>/params.yaml under " << model_dir << std::endl;
+    return 1;
+  }
+
+  std::vector<Result> results;
+  int failures = 0;
+  const char *rl_types[] = {"isaacgym", "isaaclab"};
+  for (const auto &robot_type : robot_types)
+  {
+    for (const char *rl_type : rl_types)
+    {
+      const std::string policy_dir = model_dir + "/" + robot_type + "/policy/" + rl_type;
+      if (!std::ifstream(policy_dir + "/encoder.onnx") || !std::ifstream(policy_dir + "/policy.onnx"))
+      {
+        continue;
+      }
+      PolicyConfig config;
+      const bool loaded = config.load(model_dir, robot_type, rl_type);
+      bool failed = false;
+      for (const auto &backend : backends)
+      {
+        Result result;
+        result.robot_type = robot_type;
+        result.rl_type = rl_type;
+        result.backend = backend;
+        if (!loaded)
+        {
+          result.error = "invalid params.yaml";
+        }
+        else
+        {
+          measure(backend, config, iterations, cold_runs, result);
+          if (result.error.empty())
+          {
+            checkShapes(config, &backend == &backends.front(), result);
+          }
+        }
+        failed = failed || !result.error.empty() || result.check != "ok";
+        results.push_back(result);
+      }
+      const Result &first = results.back();
+      std::printf("%-22s %-9s %s\n", robot_type.c_str(), rl_type,
+                  !first.error.empty() ? first.error.c_str() : first.check.c_str());
+      failures += failed ? 1 : 0;
+    }
+  }
+
+  std::printf("\n%-22s %-9s %-15s %10s %10s %10s %10s\n", "model", "rl_type", "backend", "cold[us]", "p50[us]",
+              "p99[us]", "max[us]");
+  for (const auto &r : results)
+  {
+    if (r.error.empty())
+    {
+      std::printf("%-22s %-9s %-15s %10.1f %10.1f %10.1f %10.1f\n", r.robot_type.c_str(), r.rl_type.c_str(),
+                  r.backend.c_str(), r.cold.p50_us, r.warm.p50_us, r.warm.p99_us, r.warm.max_us);
+    }
+  }
+
+  const bool written = writeFile(csv_path, results, false) && writeFile(json_path, results, true);
+  std::printf("%zu model pairs, %zu rows, %d with errors or shape mismatches\n", results.size() / backends.size(),
+              results.size(), failures);
+  if (!written)
+  {
+    return 1;
+  }
+  return failures ? 2 : 0;
+}
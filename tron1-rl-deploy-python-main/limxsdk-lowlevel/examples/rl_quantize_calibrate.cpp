@@ -0,0 +1,388 @@
+/**
+ * @file rl_quantize_calibrate.cpp
+ * @brief Measures fp16/int8 policy execution against fp32 on recorded robot data and writes the deployment gate.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   rl_quantize_calibrate --model-dir DIR --robot-type TYPE [--rl-type isaacgym]
+ *                         [--precision fp16,int8] [--max-error 0.05] [--kernel NAME]
+ *                         [--random N] [--dry-run] recording_dir...
+ *
+ * The flight recordings are replayed through the fp32 LocomotionController
+ * (joystick axes drive the commands as in the ability). Every inference step
+ * yields the encoder and policy inputs, on which the quantized networks are
+ * evaluated; the quantized encoder's latent replaces the fp32 one in the
+ * policy input, so both errors add up as they would on the robot. --random N
+ * adds N synthetic steps with standard normal inputs to the recorded ones;
+ * without recorded steps the results are only printed, for bring-up.
+ *
+ * Results are printed and, when the recordings yielded inference steps, stored
+ * in <policy dir>/quantization.yaml, which RLLocomotionAbility reads before
+ * running quantized weights. The exit code is non-zero if any precision
+ * exceeds --max-error.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "limxsdk/ability/flight_log.h"
+#include "limxsdk/rl/locomotion_controller.h"
+#include "limxsdk/rl/quantization.h"
+#include "limxsdk/rl/session_factory.h"
+
+using namespace limxsdk::rl;
+
+namespace
+{
+  /**
+   * @brief Network inputs of one inference step.
+   */
+  struct Step
+  {
+    std::vector<float> encoder_input;
+    std::vector<float> policy_input;
+  };
+
+  float clampAxis(float value)
+  {
+    return value > 1.0f ? 1.0f : (value < -1.0f ? -1.0f : value);
+  }
+
+  /**
+   * @brief Replays one recording through an fp32 controller and appends its inference steps.
+   */
+  bool replayRecording(const std::string &directory, LocomotionController &controller, std::vector<Step> &steps)
+  {
+    using namespace limxsdk::ability;
+    const std::vector<std::string> segments = flight_log::listSegments(directory);
+    if (segments.empty())
+    {
+      std::cerr << "No flight log segments in " << directory << std::endl;
+      return false;
+    }
+
+    const int joints = controller.config().jointCount();
+    limxsdk::RobotCmd cmd;
+    controller.prepareCommand(cmd);
+    controller.reset();
+    limxsdk::ImuData imu;
+    imu.stamp = 0;
+    imu.quat[0] = 1.0f;
+    limxsdk::RobotState state;
+    limxsdk::SensorJoy joy;
+    for (const auto &path : segments)
+    {
+      FlightSegmentReader reader;
+      if (!reader.open(path))
+      {
+        return false;
+      }
+      FlightRecordView record;
+      while (reader.next(record))
+      {
+        if (record.decode(imu))
+        {
+          continue;
+        }
+        if (record.decode(joy) && joy.axes.size() > 2)
+        {
+          controller.setCommands(clampAxis(joy.axes[1]) * 0.5f, clampAxis(joy.axes[0]) * 0.5f,
+                                 clampAxis(joy.axes[2]) * 0.5f);
+          continue;
+        }
+        if (!record.decode(state) || state.q.size() < static_cast<size_t>(joints) ||
+            state.dq.size() < static_cast<size_t>(joints))
+        {
+          continue;
+        }
+        if (!controller.update(state.q.data(), state.dq.data(), imu, cmd))
+        {
+          return false;
+        }
+        if (controller.inferred())
+        {
+          const float *history = controller.encoderInput();
+          steps.push_back(Step{std::vector<float>(history, history + controller.encoderInputSize()),
+                               controller.policyInput()});
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Encoder followed by policy, with the latent written into the policy input.
+   */
+  struct Pipeline
+  {
+    std::unique_ptr<InferenceSession> encoder;
+    std::unique_ptr<InferenceSession> policy;
+    std::vector<float> policy_input;
+    std::vector<float> actions;
+
+    bool load(const std::string &backend, const PolicyConfig &config)
+    {
+      encoder = loadInferenceSession(backend, config.encoderPath);
+      policy = loadInferenceSession(backend, config.policyPath);
+      if (!encoder || !policy)
+      {
+        return false;
+      }
+      policy_input.resize(policy->inputSize());
+      actions.resize(policy->outputSize());
+      return true;
+    }
+
+    void run(const Step &step, float clip)
+    {
+      std::copy(step.policy_input.begin(), step.policy_input.end(), policy_input.begin());
+      encoder->run(step.encoder_input.data(), policy_input.data());
+      policy->run(policy_input.data(), actions.data());
+      for (auto &a : actions)
+      {
+        a = std::max(-clip, std::min(clip, a));
+      }
+    }
+  };
+
+  double timePipeline(Pipeline &pipeline, const std::vector<Step> &steps, float clip)
+  {
+    const size_t runs = std::max<size_t>(steps.size(), 2000);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < runs; ++i)
+    {
+      pipeline.run(steps[i % steps.size()], clip);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / runs;
+  }
+
+  size_t weightBytes(const Pipeline &pipeline)
+  {
+    const MlpSession *encoder = dynamic_cast<const MlpSession *>(pipeline.encoder.get());
+    const MlpSession *policy = dynamic_cast<const MlpSession *>(pipeline.policy.get());
+    return (encoder ? encoder->network().weightBytes() : 0) + (policy ? policy->network().weightBytes() : 0);
+  }
+
+  void usage()
+  {
+    std::printf("Usage: rl_quantize_calibrate --model-dir DIR --robot-type TYPE [--rl-type isaacgym]\n"
+                "                             [--precision fp16,int8] [--max-error 0.05] [--kernel NAME]\n"
+                "                             [--random N] [--dry-run] recording_dir...\n");
+  }
+} // namespace
+
+int main(int argc, char **argv)
+{
+  std::string model_dir;
+  std::string robot_type;
+  std::string rl_type = "isaacgym";
+  std::string precisions = "fp16,int8";
+  std::string kernel;
+  double max_error = 0.05;
+  int random_steps = 0;
+  bool dry_run = false;
+  std::vector<std::string> recordings;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const bool has_value = i + 1 < argc;
+    if (arg == "--model-dir" && has_value)
+    {
+      model_dir = argv[++i];
+    }
+    else if (arg == "--robot-type" && has_value)
+    {
+      robot_type = argv[++i];
+    }
+    else if (arg == "--rl-type" && has_value)
+    {
+      rl_type = argv[++i];
+    }
+    else if (arg == "--precision" && has_value)
+    {
+      precisions = argv[++i];
+    }
+    else if (arg == "--kernel" && has_value)
+    {
+      kernel = argv[++i];
+    }
+    else if (arg == "--max-error" && has_value)
+    {
+      max_error = std::atof(argv[++i]);
+    }
+    else if (arg == "--random" && has_value)
+    {
+      random_steps = std::atoi(argv[++i]);
+    }
+    else if (arg == "--dry-run")
+    {
+      dry_run = true;
+    }
+    else if (arg == "-h" || arg == "--help")
+    {
+      usage();
+      return 0;
+    }
+    else
+    {
+      recordings.push_back(arg);
+    }
+  }
+  if (model_dir.empty() || robot_type.empty() || (recordings.empty() && random_steps <= 0))
+  {
+    usage();
+    return 1;
+  }
+
+  PolicyConfig config;
+  if (!config.load(model_dir, robot_type, rl_type))
+  {
+    return 1;
+  }
+  const std::string native = kernel.empty() ? "native" : "native:" + kernel;
+
+  // Collect the inference steps with the fp32 controller
+  std::vector<Step> steps;
+  if (!recordings.empty())
+  {
+    LocomotionController controller;
+    if (!controller.init(config, loadInferenceSession(native, config.encoderPath),
+                         loadInferenceSession(native, config.policyPath)))
+    {
+      return 1;
+    }
+    for (const auto &recording : recordings)
+    {
+      if (!replayRecording(recording, controller, steps))
+      {
+        std::cerr << "Replay of " << recording << " failed" << std::endl;
+        return 1;
+      }
+    }
+  }
+  const size_t recorded_steps = steps.size();
+  Pipeline reference;
+  if (!reference.load(native, config))
+  {
+    return 1;
+  }
+  std::mt19937 rng(1);
+  std::normal_distribution<float> normal(0.0f, 1.0f);
+  for (int s = 0; s < random_steps; ++s)
+  {
+    Step step;
+    step.encoder_input.resize(reference.encoder->inputSize());
+    step.policy_input.resize(reference.policy->inputSize());
+    for (auto &v : step.encoder_input)
+    {
+      v = normal(rng);
+    }
+    for (auto &v : step.policy_input)
+    {
+      v = normal(rng);
+    }
+    steps.push_back(step);
+  }
+  if (steps.empty())
+  {
+    std::cerr << "The recordings contain no walking inference steps" << std::endl;
+    return 1;
+  }
+
+  // fp32 actions of every step
+  const float clip = config.clipActions;
+  std::vector<std::vector<float>> expected;
+  expected.reserve(steps.size());
+  for (const auto &step : steps)
+  {
+    reference.run(step, clip);
+    expected.push_back(reference.actions);
+  }
+  const double fp32_ns = timePipeline(reference, steps, clip);
+
+  std::printf("%s/%s (%s): %zu steps, %zu recording(s), %d synthetic, bound %.4g\n", robot_type.c_str(),
+              rl_type.c_str(), native.c_str(), steps.size(), recordings.size(), random_steps, max_error);
+  std::printf("%-6s %10s %10s %10s %10s %10s %10s %9s %8s\n", "", "weights", "mean", "p50", "p99", "max", "step[us]",
+              "speedup", "gate");
+  std::printf("%-6s %9zuK %10s %10s %10s %10s %10.2f %9s %8s\n", "fp32", weightBytes(reference) / 1024, "-", "-", "-",
+              "-", fp32_ns / 1e3, "1.00", "-");
+
+  std::vector<QuantizationReport> reports;
+  bool passed = true;
+  std::stringstream list(precisions);
+  std::string name;
+  while (std::getline(list, name, ','))
+  {
+    Precision precision;
+    if (!parsePrecision(name, precision) || precision == Precision::FP32)
+    {
+      std::cerr << "Unknown quantized precision: " << name << std::endl;
+      return 1;
+    }
+    Pipeline quantized;
+    if (!quantized.load(native + ":" + name, config))
+    {
+      return 1;
+    }
+
+    std::vector<double> errors(steps.size());
+    double sum = 0.0;
+    for (size_t s = 0; s < steps.size(); ++s)
+    {
+      quantized.run(steps[s], clip);
+      double worst = 0.0;
+      for (size_t a = 0; a < quantized.actions.size(); ++a)
+      {
+        worst = std::max(worst, static_cast<double>(std::fabs(quantized.actions[a] - expected[s][a])));
+      }
+      errors[s] = worst;
+      sum += worst;
+    }
+    std::sort(errors.begin(), errors.end());
+
+    QuantizationReport report;
+    report.precision = precision;
+    report.encoderFingerprint = modelFingerprint(config.encoderPath);
+    report.policyFingerprint = modelFingerprint(config.policyPath);
+    report.samples = steps.size();
+    report.meanError = sum / steps.size();
+    report.p50Error = errors[errors.size() / 2];
+    report.p99Error = errors[std::min(errors.size() - 1, errors.size() * 99 / 100)];
+    report.maxError = errors.back();
+    report.bound = max_error;
+    report.fp32Ns = fp32_ns;
+    report.quantizedNs = timePipeline(quantized, steps, clip);
+    reports.push_back(report);
+    passed = passed && report.passed();
+
+    std::printf("%-6s %9zuK %10.2e %10.2e %10.2e %10.2e %10.2f %9.2f %8s\n", name.c_str(),
+                weightBytes(quantized) / 1024, report.meanError, report.p50Error, report.p99Error, report.maxError,
+                report.quantizedNs / 1e3, report.speedup(), report.passed() ? "pass" : "REFUSE");
+  }
+
+  if (!dry_run && recorded_steps == 0)
+  {
+    // Random inputs say nothing about the states the robot visits
+    std::printf("No recorded steps, %s not written\n", quantizationReportPath(config).c_str());
+  }
+  else if (!dry_run)
+  {
+    const std::string path = quantizationReportPath(config);
+    if (!saveQuantizationReports(path, reports))
+    {
+      return 1;
+    }
+    std::printf("Wrote %s\n", path.c_str());
+  }
+  return passed ? 0 : 2;
+}
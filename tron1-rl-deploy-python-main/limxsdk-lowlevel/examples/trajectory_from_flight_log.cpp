@@ -0,0 +1,128 @@
+/**
+ * @file trajectory_from_flight_log.cpp
+ * @brief Converts the joint stream of a flight recorder session into a trajectory file for playback.
+ * @version 1.0
+ * @date 2025-10-18
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ *
+ * Usage:
+ *   trajectory_from_flight_log <recording_dir> <output.ltrj> [--source cmd|state] [--from seconds]
+ *                              [--to seconds] [--every N]
+ *
+ * Writes one keyframe with positions and velocities for every N-th record
+ * of the chosen stream (default: the commanded targets, every record)
+ * between --from and --to seconds of the recording. Keyframe times are the
+ * capture times of the records. Records whose joint count differs from the
+ * first one, or that do not advance in time, are skipped.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "limxsdk/ability/flight_index.h"
+#include "limxsdk/trajectory/trajectory_file.h"
+
+using namespace limxsdk::ability;
+
+int main(int argc, char *argv[])
+{
+  if (argc < 3)
+  {
+    std::cout << "Usage: " << argv[0] << " <recording_dir> <output.ltrj> [--source cmd|state]"
+              << " [--from seconds] [--to seconds] [--every N]\n";
+    return 1;
+  }
+
+  std::string directory = argv[1];
+  std::string output = argv[2];
+  std::string source = "cmd";
+  double from = 0.0;
+  double to = -1.0;
+  int every = 1;
+  for (int i = 3; i + 1 < argc; i += 2)
+  {
+    std::string option = argv[i];
+    if (option == "--source") source = argv[i + 1];
+    else if (option == "--from") from = std::atof(argv[i + 1]);
+    else if (option == "--to") to = std::atof(argv[i + 1]);
+    else if (option == "--every") every = std::max(1, std::atoi(argv[i + 1]));
+  }
+  if (source != "cmd" && source != "state")
+  {
+    std::cerr << "Invalid source: " << source << " (expected cmd or state)\n";
+    return 1;
+  }
+  const uint16_t type = source == "cmd" ? FLIGHT_RECORD_ROBOT_CMD : FLIGHT_RECORD_ROBOT_STATE;
+
+  FlightLogIndex index;
+  if (!index.loadOrBuild(directory))
+  {
+    std::cerr << "No recording found in " << directory << "\n";
+    return 1;
+  }
+  const uint64_t begin = index.startTime() + static_cast<uint64_t>(from * 1e9);
+  const uint64_t end = to < 0.0 ? UINT64_MAX : index.startTime() + static_cast<uint64_t>(to * 1e9);
+
+  FlightLogCursor cursor(index);
+  if (!cursor.seek(begin))
+  {
+    std::cerr << "Start time is past the end of the recording\n";
+    return 1;
+  }
+
+  limxsdk::trajectory::TrajectoryFileWriter writer;
+  FlightRecordView record;
+  limxsdk::RobotState state;
+  limxsdk::RobotCmd cmd;
+  size_t joints = 0;
+  uint64_t seen = 0;
+  uint64_t skipped = 0;
+  while (cursor.next(record) && record.time() <= end)
+  {
+    if (record.type() != type || seen++ % every != 0)
+    {
+      continue;
+    }
+    const bool decoded = type == FLIGHT_RECORD_ROBOT_CMD ? record.decode(cmd) : record.decode(state);
+    const std::vector<float> &q = type == FLIGHT_RECORD_ROBOT_CMD ? cmd.q : state.q;
+    const std::vector<float> &dq = type == FLIGHT_RECORD_ROBOT_CMD ? cmd.dq : state.dq;
+    if (!decoded || q.empty())
+    {
+      skipped++;
+      continue;
+    }
+    if (joints == 0)
+    {
+      joints = q.size();
+      if (!writer.open(output, static_cast<uint32_t>(joints), true))
+      {
+        return 1;
+      }
+    }
+    if (q.size() != joints || !writer.append(record.time(), q.data(), dq.data()))
+    {
+      skipped++;
+    }
+  }
+
+  if (writer.keyframeCount() == 0)
+  {
+    std::cerr << "No " << source << " records between " << from << " s and the end time\n";
+    return 1;
+  }
+  if (!writer.close())
+  {
+    std::cerr << "Failed to write " << output << "\n";
+    return 1;
+  }
+  std::cout << "Wrote " << writer.keyframeCount() << " keyframes of " << joints << " joints to " << output;
+  if (skipped > 0)
+  {
+    std::cout << ", skipped " << skipped << " records";
+  }
+  std::cout << "\n";
+  return 0;
+}
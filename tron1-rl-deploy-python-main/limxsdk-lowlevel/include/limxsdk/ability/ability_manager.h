@@ -19,6 +19,8 @@
 #include <sstream>
 #include <cstring>
 #include <algorithm> 
+#include <chrono>
+#include <tuple>
 
 #ifdef _WIN32
     #include <winsock2.h>
@@ -26,6 +28,8 @@
     #pragma comment(lib, "ws2_32.lib")
 #else
     #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <sys/stat.h>
     #include <netinet/in.h>
     #include <arpa/inet.h>
     #include <unistd.h>
@@ -36,8 +40,10 @@
 #include "limxsdk/macros.h"
 #include "limxsdk/datatypes.h"
 #include "limxsdk/apibase.h"
+#include "limxsdk/ability/rate.h"
 #include "limxsdk/ability/robot_data.h"
 #include "limxsdk/ability/base_ability.h"
+#include "limxsdk/ability/status_page.h"
 #include "limxsdk/ability/plugin_registry.h"
 #include "limxsdk/ability/plugin_loader.h"
 #include "limxsdk/ability/yaml_config_parser.h"
@@ -70,58 +76,49 @@ public:
         }
         #endif
         
-        // Create socket
-        serverSocket_ = socket(AF_INET, SOCK_STREAM, 0);
-        if (serverSocket_ < 0) {
-            std::cerr << "Failed to create socket" << std::endl;
-            #ifdef _WIN32
-            WSACleanup();
-            #endif
-            return false;
-        }
-        
-        // Set socket options
-        int opt = 1;
-        if (setsockopt(serverSocket_, SOL_SOCKET, SO_REUSEADDR, 
-                      reinterpret_cast<const char*>(&opt), sizeof(opt)) < 0) {
-            std::cerr << "Failed to set socket options" << std::endl;
-            closeSocket(serverSocket_);
-            #ifdef _WIN32
-            WSACleanup();
-            #endif
-            return false;
+        // Open the TCP endpoint
+        if (tcpEnabled_) {
+            serverSocket_ = openTcpSocket();
+            if (serverSocket_ == INVALID_SOCKET) {
+                #ifdef _WIN32
+                WSACleanup();
+                #endif
+                return false;
+            }
         }
-        
-        // Bind socket
-        sockaddr_in serverAddr{};
-        serverAddr.sin_family = AF_INET;
-        serverAddr.sin_addr.s_addr = INADDR_ANY;
-        serverAddr.sin_port = htons(port_);
-        
-        if (bind(serverSocket_, reinterpret_cast<sockaddr*>(&serverAddr), sizeof(serverAddr)) < 0) {
-            std::cerr << "Failed to bind socket" << std::endl;
-            closeSocket(serverSocket_);
-            #ifdef _WIN32
-            WSACleanup();
-            #endif
-            return false;
+
+        // Open the local AF_UNIX endpoint
+        #ifndef _WIN32
+        if (!unixSocketPath_.empty()) {
+            unixServerSocket_ = openUnixSocket();
+            if (unixServerSocket_ == INVALID_SOCKET) {
+                if (serverSocket_ != INVALID_SOCKET) {
+                    closeSocket(serverSocket_);
+                    serverSocket_ = INVALID_SOCKET;
+                }
+                return false;
+            }
         }
-        
-        // Listen for connections
-        if (listen(serverSocket_, 5) < 0) {
-            std::cerr << "Failed to listen on socket" << std::endl;
-            closeSocket(serverSocket_);
+        #endif
+
+        if (serverSocket_ == INVALID_SOCKET && unixServerSocket_ == INVALID_SOCKET) {
+            std::cerr << "No remote CLI endpoint enabled" << std::endl;
             #ifdef _WIN32
             WSACleanup();
             #endif
             return false;
         }
         
-        // Start server thread
+        // Start one server thread per endpoint
         running_ = true;
-        serverThread_ = std::thread(&RemoteCliServer::serverThread, this);
-        
-        std::cout << "Remote CLI server started on port " << port_ << std::endl;
+        if (serverSocket_ != INVALID_SOCKET) {
+            serverThread_ = std::thread(&RemoteCliServer::serverThread, this, serverSocket_);
+            std::cout << "Remote CLI server started on " << tcpAddress_ << ":" << port_ << std::endl;
+        }
+        if (unixServerSocket_ != INVALID_SOCKET) {
+            unixServerThread_ = std::thread(&RemoteCliServer::serverThread, this, unixServerSocket_);
+            std::cout << "Remote CLI server started on unix:" << unixSocketPath_ << std::endl;
+        }
         return true;
     }
 
@@ -136,21 +133,32 @@ public:
         {
             std::lock_guard<std::mutex> lock(clientsMutex_);
             for (SOCKET socket : clientSockets_) {
-                closeSocket(socket);
+                shutdownSocket(socket);
             }
-            clientSockets_.clear();
         }
         
-        // Close server socket
+        // Close server sockets; shutdown() wakes up threads blocked in accept()
         if (serverSocket_ != INVALID_SOCKET) {
+            shutdownSocket(serverSocket_);
             closeSocket(serverSocket_);
             serverSocket_ = INVALID_SOCKET;
         }
+        if (unixServerSocket_ != INVALID_SOCKET) {
+            shutdownSocket(unixServerSocket_);
+            closeSocket(unixServerSocket_);
+            unixServerSocket_ = INVALID_SOCKET;
+            #ifndef _WIN32
+            unlink(unixSocketPath_.c_str());
+            #endif
+        }
         
-        // Wait for server thread to finish
+        // Wait for server threads to finish
         if (serverThread_.joinable()) {
             serverThread_.join();
         }
+        if (unixServerThread_.joinable()) {
+            unixServerThread_.join();
+        }
         
         #ifdef _WIN32
         WSACleanup();
@@ -158,6 +166,24 @@ public:
         
         std::cout << "Remote CLI server stopped" << std::endl;
     }
+
+    /**
+     * @brief Configures the TCP endpoint. Must be called before start().
+     * @param enabled Whether the TCP endpoint is opened at all.
+     * @param address IPv4 bind address, e.g. "127.0.0.1" to accept local connections only.
+     */
+    void setTcpEndpoint(bool enabled, const std::string& address) {
+        tcpEnabled_ = enabled;
+        tcpAddress_ = address.empty() ? "0.0.0.0" : address;
+    }
+
+    /**
+     * @brief Configures the local AF_UNIX endpoint. Must be called before start().
+     * @param path Filesystem path of the socket, empty to disable.
+     */
+    void setUnixSocketPath(const std::string& path) {
+        unixSocketPath_ = path;
+    }
     
     void registerCommand(const std::string& command, CommandHandler handler, const std::string& helpText) {
         commandHandlers_[command] = std::make_pair(handler, helpText);
@@ -175,18 +201,98 @@ public:
     }
     
 private:
-    void serverThread() {
+    SOCKET openTcpSocket() {
+        // Create socket
+        SOCKET sock = socket(AF_INET, SOCK_STREAM, 0);
+        if (sock == INVALID_SOCKET) {
+            std::cerr << "Failed to create socket" << std::endl;
+            return INVALID_SOCKET;
+        }
+        
+        // Set socket options
+        int opt = 1;
+        if (setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, 
+                      reinterpret_cast<const char*>(&opt), sizeof(opt)) < 0) {
+            std::cerr << "Failed to set socket options" << std::endl;
+            closeSocket(sock);
+            return INVALID_SOCKET;
+        }
+        
+        // Bind socket
+        sockaddr_in serverAddr{};
+        serverAddr.sin_family = AF_INET;
+        serverAddr.sin_port = htons(port_);
+        if (inet_pton(AF_INET, tcpAddress_.c_str(), &serverAddr.sin_addr) != 1) {
+            std::cerr << "Invalid remote CLI bind address: " << tcpAddress_ << std::endl;
+            closeSocket(sock);
+            return INVALID_SOCKET;
+        }
+        
+        if (bind(sock, reinterpret_cast<sockaddr*>(&serverAddr), sizeof(serverAddr)) < 0) {
+            std::cerr << "Failed to bind socket" << std::endl;
+            closeSocket(sock);
+            return INVALID_SOCKET;
+        }
+        
+        // Listen for connections
+        if (listen(sock, 5) < 0) {
+            std::cerr << "Failed to listen on socket" << std::endl;
+            closeSocket(sock);
+            return INVALID_SOCKET;
+        }
+        return sock;
+    }
+
+    #ifndef _WIN32
+    SOCKET openUnixSocket() {
+        sockaddr_un serverAddr{};
+        if (unixSocketPath_.size() >= sizeof(serverAddr.sun_path)) {
+            std::cerr << "Unix socket path too long: " << unixSocketPath_ << std::endl;
+            return INVALID_SOCKET;
+        }
+
+        SOCKET sock = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (sock == INVALID_SOCKET) {
+            std::cerr << "Failed to create unix socket" << std::endl;
+            return INVALID_SOCKET;
+        }
+
+        // Remove a stale socket file left behind by a previous run
+        unlink(unixSocketPath_.c_str());
+
+        serverAddr.sun_family = AF_UNIX;
+        std::strncpy(serverAddr.sun_path, unixSocketPath_.c_str(), sizeof(serverAddr.sun_path) - 1);
+        if (bind(sock, reinterpret_cast<sockaddr*>(&serverAddr), sizeof(serverAddr)) < 0) {
+            std::cerr << "Failed to bind unix socket: " << unixSocketPath_ << std::endl;
+            closeSocket(sock);
+            return INVALID_SOCKET;
+        }
+
+        // Owner and group only; filesystem permissions are the access control
+        chmod(unixSocketPath_.c_str(), 0660);
+
+        if (listen(sock, 5) < 0) {
+            std::cerr << "Failed to listen on unix socket: " << unixSocketPath_ << std::endl;
+            closeSocket(sock);
+            unlink(unixSocketPath_.c_str());
+            return INVALID_SOCKET;
+        }
+        return sock;
+    }
+    #endif
+
+    void serverThread(SOCKET listenSocket) {
         while (running_) {
             // Accept client connection
-            sockaddr_in clientAddr{};
+            sockaddr_storage clientAddr{};
             #ifdef _WIN32
             int clientAddrLen = sizeof(clientAddr);
             #else
             socklen_t clientAddrLen = sizeof(clientAddr);
             #endif
-            SOCKET clientSocket = accept(serverSocket_, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
+            SOCKET clientSocket = accept(listenSocket, reinterpret_cast<sockaddr*>(&clientAddr), &clientAddrLen);
             
-            if (clientSocket < 0) {
+            if (clientSocket == INVALID_SOCKET) {
                 if (running_) {
                     std::cerr << "Failed to accept client connection" << std::endl;
                 }
@@ -200,13 +306,14 @@ private:
             }
             
             // Handle client connection
-            #ifdef _WIN32
-            char clientIP[INET_ADDRSTRLEN];
-            inet_ntop(AF_INET, &(clientAddr.sin_addr), clientIP, INET_ADDRSTRLEN);
-            std::cout << "New client connected: " << clientIP << ":" << ntohs(clientAddr.sin_port) << std::endl;
-            #else
-            std::cout << "New client connected: " << inet_ntoa(clientAddr.sin_addr) << ":" << ntohs(clientAddr.sin_port) << std::endl;
-            #endif
+            if (clientAddr.ss_family == AF_INET) {
+                const sockaddr_in* inAddr = reinterpret_cast<const sockaddr_in*>(&clientAddr);
+                char clientIP[INET_ADDRSTRLEN];
+                inet_ntop(AF_INET, &(inAddr->sin_addr), clientIP, INET_ADDRSTRLEN);
+                std::cout << "New client connected: " << clientIP << ":" << ntohs(inAddr->sin_port) << std::endl;
+            } else {
+                std::cout << "New local client connected" << std::endl;
+            }
             
             handleClient(clientSocket);
             
@@ -315,18 +422,27 @@ private:
         close(sock);
         #endif
     }
+
+    // Cross-platform helper function to abort pending operations on sockets
+    void shutdownSocket(SOCKET sock) {
+        #ifdef _WIN32
+        shutdown(sock, SD_BOTH);
+        #else
+        shutdown(sock, SHUT_RDWR);
+        #endif
+    }
     
     int port_;
+    bool tcpEnabled_;
+    std::string tcpAddress_;
+    std::string unixSocketPath_;
     AbilityManager* abilityManager_;
     std::atomic<bool> running_;
     std::thread serverThread_;
-    #ifdef _WIN32
+    std::thread unixServerThread_;
     SOCKET serverSocket_;
+    SOCKET unixServerSocket_;
     std::vector<SOCKET> clientSockets_;
-    #else
-    int serverSocket_;
-    std::vector<int> clientSockets_;
-    #endif
     mutable std::mutex clientsMutex_;
     
     std::unordered_map<std::string, std::pair<CommandHandler, std::string>> commandHandlers_;
@@ -334,17 +450,27 @@ private:
 
 class LIMX_SDK_API AbilityManager {
 public:
-    AbilityManager(const std::string& configPath) {
-        // Initialize remote CLI server
-        cliServer_ = std::unique_ptr<RemoteCliServer>(new RemoteCliServer(8888, this));
-
+    AbilityManager(const std::string& configPath) : statusRunning_(false) {
         SystemConfig config = YamlConfigParser::parse(configPath);
 
+        // Initialize remote CLI server
+        cliServer_ = std::unique_ptr<RemoteCliServer>(new RemoteCliServer(config.remoteCli.tcpPort, this));
+        cliServer_->setTcpEndpoint(config.remoteCli.tcpEnabled, config.remoteCli.tcpAddress);
+        cliServer_->setUnixSocketPath(config.remoteCli.unixSocket);
+
         // Apply system configuration
         std::cout << "Robot IP: " << config.robotIp << std::endl;
         std::cout << "Robot Type: " << config.robotType << std::endl;
 
-        robotData_ = std::unique_ptr<RobotData>(new RobotData(config.robotIp, config.robotType));
+        robotData_ = std::unique_ptr<RobotData>(new RobotData(config.robotIp, config.robotType, config.imuEstimator,
+                                                     config.baseVelocity));
+
+        // Record robot streams before any ability starts commanding
+        if (!config.flightRecorder.directory.empty()) {
+            if (!robotData_->start_flight_recorder(config.flightRecorder)) {
+                std::cerr << "Failed to start flight recorder" << std::endl;
+            }
+        }
 
         // Load libraries and abilities
         for (const auto& library : config.libraries) {
@@ -360,9 +486,32 @@ public:
                 }
             }
         }
+
+        // Start log playback or the loopback simulator once the abilities have subscribed
+        if (config.robotType == "Replay") {
+            limxsdk::Replay* replay = limxsdk::Replay::getInstance();
+            replay->setSpeed(config.replay.speed);
+            replay->setLoop(config.replay.loop);
+            replay->setLockstep(config.replay.lockstep);
+            replay->setCaptureCommands(false);
+            replay->start();
+        } else if (config.robotType == "Loopback") {
+            limxsdk::Loopback* loopback = limxsdk::Loopback::getInstance();
+            loopback->setRate(config.loopback.rate, config.loopback.substeps);
+            loopback->setSpeed(config.loopback.speed);
+            loopback->setLockstep(config.loopback.lockstep);
+            loopback->start();
+        }
+
+        // Publish the shared memory status page if configured
+        if (!config.statusPage.name.empty()) {
+            startStatusPage(config.statusPage.name, config.statusPage.rate);
+        }
     }
 
     ~AbilityManager() {
+        stopStatusPage();
+
         // Stop all abilities
         for (auto& pair : abilities_) {
             pair.second->stop();
@@ -372,10 +521,12 @@ public:
     }
     
     bool loadAbility(const std::string& soPath, const std::string& abilityName, const std::string& className, const YAML::Node& config = YAML::Node()) {
+        ApiBase* robot = robotData_->get_robot_instance();
+
         // Load plugin library
         if (!PluginManager::getInstance().loadPlugin(soPath)) {
             std::cerr << "Failed to load plugin library: " << soPath << std::endl;
-            robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "load", -1, 2, "Failed to load plugin library: " + soPath);
+            diagnosticsFor(abilityName).loadFailed.publish(robot, "Failed to load plugin library: " + soPath);
             return false;
         }
         
@@ -383,14 +534,14 @@ public:
         auto ability = PluginRegistry::create<BaseAbility>(className);
         if (!ability) {
             std::cerr << "Failed to create ability instance: " << className << std::endl;
-            robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "load", -1, 2, "Failed to create ability instance: " + className);
+            diagnosticsFor(abilityName).loadFailed.publish(robot, "Failed to create ability instance: " + className);
             return false;
         }
         
         // Initialize ability
         if (!ability->on_init(config)) {
             std::cerr << "Failed to initialize ability: " << abilityName << std::endl;
-            robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "load", -1, 2, "Failed to initialize ability: " + abilityName);
+            diagnosticsFor(abilityName).loadFailed.publish(robot, "Failed to initialize ability: " + abilityName);
             return false;
         }
         
@@ -398,9 +549,10 @@ public:
         ability->name_ = abilityName;
         ability->type_ = className;
         ability->robot_ = robotData_.get();
+        ability->_init_diagnostics();
 
         abilities_[abilityName] = std::move(ability);
-        robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "load", 0, 0, "Successfully loaded ability: " + abilityName + " (" + className + ")");
+        diagnosticsFor(abilityName).loaded.publish(robot, "Successfully loaded ability: " + abilityName + " (" + className + ")");
         std::cout << "Successfully loaded ability: " << abilityName << " (" << className << ")" << std::endl;
         return true;
     }
@@ -409,7 +561,7 @@ public:
         auto it = abilities_.find(abilityName);
         if (it == abilities_.end()) {
             std::cerr << "Ability not found: " << abilityName << std::endl;
-            robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "start", -1, 2, "Ability not found: " + abilityName);
+            diagnosticsFor(abilityName).startNotFound.publish(robotData_->get_robot_instance());
             return false;
         }
         
@@ -426,7 +578,7 @@ public:
         auto it = abilities_.find(abilityName);
         if (it == abilities_.end()) {
             std::cerr << "Ability not found: " << abilityName << std::endl;
-            robotData_->get_robot_instance()->publishDiagnostic("ability/" + abilityName, "stop", -1, 2, "Ability not found: " + abilityName);
+            diagnosticsFor(abilityName).stopNotFound.publish(robotData_->get_robot_instance());
             return false;
         }
         
@@ -460,6 +612,75 @@ public:
         return abilities;
     }
     
+    std::string listAbilityStats() const {
+        StatusPageData data;
+        collectStatus(data);
+
+        std::stringstream ss;
+        for (uint32_t i = 0; i < data.ability_count; ++i) {
+            const StatusPageAbility& entry = data.abilities[i];
+            ss << "\n  * " << entry.name
+               << " [cycles: " << entry.cycles
+               << ", overruns: " << entry.overruns
+               << ", last: " << entry.last_cycle_ns / 1000.0 << " us"
+               << ", max: " << entry.max_cycle_ns / 1000.0 << " us"
+               << ", period: " << entry.expected_cycle_ns / 1000.0 << " us]";
+        }
+        return ss.str();
+    }
+
+    std::string flightRecorderStatus() const {
+        FlightRecorder* recorder = robotData_ ? robotData_->get_flight_recorder() : nullptr;
+        if (!recorder) {
+            return "Flight recorder is not running";
+        }
+        FlightRecorderStats stats = recorder->stats();
+        std::stringstream ss;
+        ss << "Flight recorder: " << recorder->sessionDirectory()
+           << "\n  records: " << stats.records
+           << "\n  bytes: " << stats.bytes
+           << "\n  dropped: " << stats.dropped
+           << "\n  segments: " << stats.segments
+           << "\n  dumps: " << stats.dumps;
+        return ss.str();
+    }
+
+    bool requestFlightDump() {
+        FlightRecorder* recorder = robotData_ ? robotData_->get_flight_recorder() : nullptr;
+        if (!recorder) {
+            return false;
+        }
+        recorder->requestDump();
+        return true;
+    }
+
+    void collectStatus(StatusPageData& data) const {
+        std::memset(&data, 0, sizeof(data));
+        data.stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        #ifndef _WIN32
+        data.pid = static_cast<uint32_t>(getpid());
+        #endif
+
+        for (const auto& pair : abilities_) {
+            if (data.ability_count >= StatusPageData::MAX_ABILITIES) {
+                break;
+            }
+            StatusPageAbility& entry = data.abilities[data.ability_count++];
+            const BaseAbility& ability = *pair.second;
+            const LoopStats& stats = ability.getLoopStats();
+            std::strncpy(entry.name, pair.first.c_str(), sizeof(entry.name) - 1);
+            std::strncpy(entry.type, ability.type_.c_str(), sizeof(entry.type) - 1);
+            entry.running = ability.isRunning() ? 1 : 0;
+            entry.start_count = ability.getStartCount();
+            entry.cycles = stats.cycles.load(std::memory_order_relaxed);
+            entry.overruns = stats.overruns.load(std::memory_order_relaxed);
+            entry.last_cycle_ns = stats.last_cycle_ns.load(std::memory_order_relaxed);
+            entry.max_cycle_ns = stats.max_cycle_ns.load(std::memory_order_relaxed);
+            entry.expected_cycle_ns = stats.expected_cycle_ns.load(std::memory_order_relaxed);
+        }
+    }
+    
     // Remote CLI server methods
     bool startRemoteServer() {
         return cliServer_->start();
@@ -468,15 +689,78 @@ public:
     void stopRemoteServer() {
         cliServer_->stop();
     }
+
+    // Shared memory status page methods
+    bool startStatusPage(const std::string& name, double rate) {
+        if (statusRunning_) {
+            return true;
+        }
+        if (!statusPage_.open(name)) {
+            return false;
+        }
+
+        statusRunning_ = true;
+        statusThread_ = std::thread([this, rate]() {
+            Rate loopRate(rate > 0.0 ? rate : 10.0);
+            StatusPageData data;
+            while (statusRunning_) {
+                collectStatus(data);
+                statusPage_.publish(data);
+                loopRate.sleep();
+            }
+        });
+        return true;
+    }
+
+    void stopStatusPage() {
+        statusRunning_ = false;
+        if (statusThread_.joinable()) {
+            statusThread_.join();
+        }
+        statusPage_.close();
+    }
     
+    /**
+     * Lifecycle diagnostics of one ability name, preformatted on first use.
+     */
+    struct AbilityDiagnostics {
+        explicit AbilityDiagnostics(const std::string& name)
+            : loaded("ability/" + name, "load", 0, DiagnosticValue::OK, "", 0.0),
+              loadFailed("ability/" + name, "load", -1, DiagnosticValue::ERROR, "", 0.0),
+              startNotFound("ability/" + name, "start", -1, DiagnosticValue::ERROR, "Ability not found: " + name),
+              stopNotFound("ability/" + name, "stop", -1, DiagnosticValue::ERROR, "Ability not found: " + name) {}
+
+        DiagnosticTemplate loaded;
+        DiagnosticTemplate loadFailed;
+        DiagnosticTemplate startNotFound;
+        DiagnosticTemplate stopNotFound;
+    };
+
+    // Entries are never removed, so the returned reference stays valid
+    AbilityDiagnostics& diagnosticsFor(const std::string& abilityName) {
+        std::lock_guard<std::mutex> lock(diagnosticsMutex_);
+        auto it = abilityDiagnostics_.find(abilityName);
+        if (it == abilityDiagnostics_.end()) {
+            it = abilityDiagnostics_.emplace(std::piecewise_construct, std::forward_as_tuple(abilityName),
+                                             std::forward_as_tuple(abilityName)).first;
+        }
+        return it->second;
+    }
+
     std::unordered_map<std::string, std::unique_ptr<BaseAbility>> abilities_;
+    std::unordered_map<std::string, AbilityDiagnostics> abilityDiagnostics_;
+    std::mutex diagnosticsMutex_;
     std::unique_ptr<RemoteCliServer> cliServer_;
     std::unique_ptr<RobotData> robotData_;
+    StatusPageWriter statusPage_;
+    std::atomic<bool> statusRunning_;
+    std::thread statusThread_;
 };
 
 
 RemoteCliServer::RemoteCliServer(int port, AbilityManager* abilityManager)
-    : port_(port), abilityManager_(abilityManager), running_(false), serverSocket_(INVALID_SOCKET) {
+    : port_(port), tcpEnabled_(true), tcpAddress_("0.0.0.0"), abilityManager_(abilityManager), running_(false),
+      serverSocket_(INVALID_SOCKET), unixServerSocket_(INVALID_SOCKET) {
     // Register built-in commands
     registerCommand("help", [this](const std::vector<std::string>& args) {
         return getHelpText();
@@ -488,6 +772,21 @@ RemoteCliServer::RemoteCliServer(int port, AbilityManager* abilityManager)
         ss << abilityManager_->listAbilities();
         return ss.str();
     }, "List all available abilities");
+
+    registerCommand("stats", [this](const std::vector<std::string>& args) {
+        std::stringstream ss;
+        ss << "Ability loop statistics:";
+        ss << abilityManager_->listAbilityStats();
+        return ss.str();
+    }, "Show loop statistics of all abilities");
+
+    registerCommand("recorder", [this](const std::vector<std::string>& args) {
+        if (args.size() >= 2 && args[1] == "dump") {
+            return abilityManager_->requestFlightDump() ? std::string("Flight recorder dump requested")
+                                                        : std::string("Flight recorder is not running");
+        }
+        return abilityManager_->flightRecorderStatus();
+    }, "Show flight recorder status, or 'recorder dump' to save the last seconds");
     
     registerCommand("start", [this](const std::vector<std::string>& args) {
         if (args.size() < 2) {
@@ -18,6 +18,7 @@
 #include "limxsdk/datatypes.h"
 #include "limxsdk/apibase.h"
 #include "limxsdk/ability/rate.h"
+#include "limxsdk/ability/diagnostics.h"
 #include "limxsdk/ability/robot_data.h"
 #include "limxsdk/ability/plugin_registry.h"
 
@@ -88,39 +89,73 @@ namespace limxsdk
       bool isRunning() const { return running_; }
       std::string getName() const { return name_; }
       std::string getType() const { return type_; }
+      const LoopStats &getLoopStats() const { return loop_stats_; }
+      uint64_t getStartCount() const { return start_count_; }
 
       // Interface methods
       limxsdk::ImuData get_imu_data() const { return robot_->get_imu_data(); }
+      ImuEstimate get_imu_estimate() const { return robot_->get_imu_estimate(); }
+      BaseVelocityEstimate get_base_velocity() const { return robot_->get_base_velocity(); }
       limxsdk::RobotState get_robot_state() const { return robot_->get_robot_state(); }
       limxsdk::ApiBase *get_robot_instance() const { return robot_->get_robot_instance(); }
+      bool publish_robot_cmd(const limxsdk::RobotCmd &cmd) const { return robot_->publish_robot_cmd(cmd); }
+
+      /**
+       * Creates a diagnostic named "ability/<name>" once, for abilities that report from their main loop.
+       * Publishing the returned template allocates nothing and is rate limited to one per @p min_interval_sec.
+       */
+      DiagnosticTemplate make_diagnostic(const std::string &part, int code, int level,
+                                         const std::string &message = "", double min_interval_sec = 1.0) const
+      {
+        return DiagnosticTemplate("ability/" + name_, part, code, level, message, min_interval_sec);
+      }
+
+      // Preformats the lifecycle diagnostics once the ability name is known
+      void _init_diagnostics()
+      {
+        diag_start_ = make_diagnostic("start", 0, DiagnosticValue::OK, "", 0.0);
+        diag_stop_ = make_diagnostic("stop", 0, DiagnosticValue::OK, "", 0.0);
+        diag_failed_ = make_diagnostic("start", -1, DiagnosticValue::ERROR, "", 1.0);
+      }
 
       void _run()
       {
+        // Bind loop statistics so every Rate::sleep() on this thread is measured
+        loop_stats_.reset();
+        start_count_++;
+        LoopStats::current() = &loop_stats_;
+
         try
         {
-          get_robot_instance()->publishDiagnostic("ability/" + name_, "start", 0, 0);
+          diag_start_.publish(get_robot_instance());
           on_start();
           on_main();
-          get_robot_instance()->publishDiagnostic("ability/" + name_, "stop", 0, 0);
+          diag_stop_.publish(get_robot_instance());
         }
         catch (const std::exception &e)
         {
           std::cerr << "Ability failed: " << e.what() << std::endl;
-          get_robot_instance()->publishDiagnostic("ability/" + name_, "start", -1, 2, std::string("Ability failed: ") + e.what());
+          diag_failed_.publish(get_robot_instance(), std::string("Ability failed: ") + e.what());
         }
         catch (...)
         {
           std::cerr << "Ability failed: Unknown exception" << std::endl;
-          get_robot_instance()->publishDiagnostic("ability/" + name_, "start", -1, 2, "Unknown exception");
+          diag_failed_.publish(get_robot_instance(), "Unknown exception");
         }
 
         on_stop();
+        LoopStats::current() = nullptr;
         running_ = false;
       }
 
       std::string name_;
       std::string type_;
-      std::atomic<bool> running_;
+      std::atomic<bool> running_{false};
+      std::atomic<uint64_t> start_count_{0};
+      LoopStats loop_stats_;
+      DiagnosticTemplate diag_start_;
+      DiagnosticTemplate diag_stop_;
+      DiagnosticTemplate diag_failed_;
       std::thread thread_;
       std::mutex mutex_;
       RobotData *robot_;
@@ -0,0 +1,281 @@
+/**
+ * @file base_velocity_estimator.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef BASE_VELOCITY_ESTIMATOR_H
+#define BASE_VELOCITY_ESTIMATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/ability/imu_estimator.h"
+#include "limxsdk/ability/seqlock.h"
+#include "limxsdk/model/leg_kinematics.h"
+
+namespace limxsdk {
+namespace ability {
+
+struct LIMX_SDK_API BaseVelocityEstimatorConfig {
+    bool enabled = false;           // Needs the leg geometry of the robot
+    model::LegGeometry geometry = model::LegGeometry::nominal(model::LegType::POINTFOOT);
+    float accNoise = 0.5f;          // Accelerometer noise density driving the prediction, m/s^2/sqrt(Hz)
+    float contactNoise = 0.1f;      // Standard deviation of a stance leg's velocity measurement, m/s
+    float contactHeight = 0.03f;    // Legs this close above the lowest contact point count as stance, m
+    float maxGap = 0.1f;            // Longer gaps between robot states restart the filter, s
+};
+
+/**
+ * @struct BaseVelocityEstimate
+ * @brief Linear velocity of the base as of one robot state.
+ */
+struct LIMX_SDK_API BaseVelocityEstimate {
+    uint64_t stamp;                 // Stamp of the robot state, 0 before the first estimate
+    uint64_t updates;
+    float linVel[3];                // World frame, yaw as in ImuEstimate::quat, m/s
+    float linVelBody[3];            // Base frame, as the policies' base_lin_vel, m/s
+    float variance[3];              // Diagonal of the world frame covariance
+    uint8_t contact[2];             // Legs used as stance legs in this update, left and right
+};
+
+/**
+ * @class BaseVelocityEstimator
+ * @brief Kalman filter fusing the accelerometer with the leg kinematics of the stance legs.
+ *
+ * The state is the world-frame base velocity. Each robot state predicts it
+ * with the gravity-compensated accelerometer rotated by the ImuEstimator
+ * orientation, then corrects it with every stance leg: a stance foot is
+ * assumed not to move, so the base moves opposite to the foot velocity
+ * from the joint velocities and the body rotation. A wheel is assumed to
+ * roll without slipping, which adds the wheel spin at its contact point.
+ * Stance legs are those whose contact point is within contactHeight of the
+ * lowest one. All matrices are 3x3, so an update costs well under a
+ * microsecond and allocates nothing. update() must be called from one
+ * thread; load() may be called from any.
+ */
+class LIMX_SDK_API BaseVelocityEstimator {
+public:
+    explicit BaseVelocityEstimator(const BaseVelocityEstimatorConfig& config = BaseVelocityEstimatorConfig())
+        : config_(config) {}
+
+    const BaseVelocityEstimatorConfig& config() const { return config_; }
+
+    /**
+     * @brief Filters one robot state; @p state holds the left leg joints followed by the right leg joints.
+     */
+    void update(const RobotState& state, const ImuEstimate& imu) {
+        const int joints = config_.geometry.joints;
+        if (imu.samples == 0 || state.q.size() < static_cast<size_t>(2 * joints) || state.dq.size() < state.q.size()) {
+            return;
+        }
+        const double dt = static_cast<double>(state.stamp - stamp_) * 1e-9;
+        const bool restart = updates_ == 0 || state.stamp <= stamp_ || dt > config_.maxGap;
+        stamp_ = state.stamp;
+        updates_++;
+
+        float R[9];
+        rotation(imu.quat, R);
+        if (restart) {
+            for (int i = 0; i < 9; ++i) {
+                P_[i] = i % 4 == 0 ? 1.0f : 0.0f;
+            }
+            for (int i = 0; i < 3; ++i) {
+                v_[i] = 0.0f;
+            }
+        } else {
+            // Predict with the specific force rotated into the world plus gravity
+            float a[3];
+            multiply(R, imu.acc, a);
+            a[2] -= 9.81f;
+            const float step = static_cast<float>(dt);
+            for (int i = 0; i < 3; ++i) {
+                v_[i] += a[i] * step;
+                P_[4 * i] += config_.accNoise * config_.accNoise * step;
+            }
+        }
+
+        // Stance candidates from the contact point heights in the world frame
+        float measured[2][3];
+        float height[2];
+        switch (config_.geometry.type) {
+        case model::LegType::POINTFOOT:
+            measure<model::LegType::POINTFOOT>(state, imu, R, measured, height);
+            break;
+        case model::LegType::SOLEFOOT:
+            measure<model::LegType::SOLEFOOT>(state, imu, R, measured, height);
+            break;
+        case model::LegType::WHEELFOOT:
+            measure<model::LegType::WHEELFOOT>(state, imu, R, measured, height);
+            break;
+        }
+        const float lowest = std::min(height[0], height[1]);
+        uint8_t contact[2];
+        for (int side = 0; side < 2; ++side) {
+            contact[side] = height[side] - lowest < config_.contactHeight ? 1 : 0;
+            if (contact[side]) {
+                correct(measured[side]);
+            }
+        }
+
+        BaseVelocityEstimate estimate;
+        estimate.stamp = state.stamp;
+        estimate.updates = updates_;
+        for (int i = 0; i < 3; ++i) {
+            estimate.linVel[i] = v_[i];
+            estimate.linVelBody[i] = R[i] * v_[0] + R[3 + i] * v_[1] + R[6 + i] * v_[2];
+            estimate.variance[i] = P_[4 * i];
+        }
+        estimate.contact[0] = contact[0];
+        estimate.contact[1] = contact[1];
+        published_.store(estimate);
+    }
+
+    /**
+     * @brief Latest estimate; updates is 0 until the first robot state with an IMU estimate.
+     */
+    BaseVelocityEstimate load() const { return published_.load(); }
+
+private:
+    // Base velocity implied by a static contact of each leg, and the height of that contact
+    template <model::LegType TYPE>
+    void measure(const RobotState& state, const ImuEstimate& imu, const float R[9], float out[2][3],
+                 float height[2]) const {
+        typedef model::LegKinematics<TYPE> Kinematics;
+        const Kinematics kinematics(config_.geometry);
+        typename Kinematics::State legs;
+        kinematics.compute(state.q.data(), legs);
+        float velocity[2][3];
+        Kinematics::velocity(legs, state.dq.data(), velocity);
+
+        for (int side = 0; side < 2; ++side) {
+            float* p = legs.position[side];
+            float* v = velocity[side];
+            if (TYPE == model::LegType::WHEELFOOT) {
+                // Contact point: from the centre towards gravity, perpendicular to the wheel axis
+                const float* axis = legs.wheelAxis[side];
+                const float* down = imu.projectedGravity;
+                const float along = down[0] * axis[0] + down[1] * axis[1] + down[2] * axis[2];
+                float radial[3] = {down[0] - along * axis[0], down[1] - along * axis[1], down[2] - along * axis[2]};
+                const float norm = std::sqrt(radial[0] * radial[0] + radial[1] * radial[1] + radial[2] * radial[2]);
+                const float r = norm > 1e-6f ? config_.geometry.wheelRadius / norm : 0.0f;
+                const float spin = state.dq[side * Kinematics::JOINTS + Kinematics::JOINTS - 1];
+                for (int i = 0; i < 3; ++i) {
+                    radial[i] *= r;
+                    p[i] += radial[i];
+                }
+                v[0] += spin * (axis[1] * radial[2] - axis[2] * radial[1]);
+                v[1] += spin * (axis[2] * radial[0] - axis[0] * radial[2]);
+                v[2] += spin * (axis[0] * radial[1] - axis[1] * radial[0]);
+            }
+            // Foot velocity in the base frame: w x p + v; the base moves the opposite way
+            const float* w = imu.gyro;
+            const float foot[3] = {w[1] * p[2] - w[2] * p[1] + v[0], w[2] * p[0] - w[0] * p[2] + v[1],
+                                   w[0] * p[1] - w[1] * p[0] + v[2]};
+            multiply(R, foot, out[side]);
+            for (int i = 0; i < 3; ++i) {
+                out[side][i] = -out[side][i];
+            }
+            height[side] = R[6] * p[0] + R[7] * p[1] + R[8] * p[2];
+        }
+    }
+
+    // Kalman update with a direct velocity measurement of covariance contactNoise^2 * I
+    void correct(const float z[3]) {
+        float S[9];
+        for (int i = 0; i < 9; ++i) {
+            S[i] = P_[i];
+        }
+        const float noise = config_.contactNoise * config_.contactNoise;
+        S[0] += noise;
+        S[4] += noise;
+        S[8] += noise;
+        float Sinv[9];
+        if (!invert(S, Sinv)) {
+            return;
+        }
+        float K[9];
+        multiply3(P_, Sinv, K);
+        const float innovation[3] = {z[0] - v_[0], z[1] - v_[1], z[2] - v_[2]};
+        float dv[3];
+        multiply(K, innovation, dv);
+        for (int i = 0; i < 3; ++i) {
+            v_[i] += dv[i];
+        }
+        // P = (I - K) P, kept symmetric
+        float KP[9];
+        multiply3(K, P_, KP);
+        for (int i = 0; i < 9; ++i) {
+            P_[i] -= KP[i];
+        }
+        for (int r = 0; r < 3; ++r) {
+            for (int c = r + 1; c < 3; ++c) {
+                const float mean = 0.5f * (P_[3 * r + c] + P_[3 * c + r]);
+                P_[3 * r + c] = mean;
+                P_[3 * c + r] = mean;
+            }
+        }
+    }
+
+    // Row-major rotation of the quaternion (w, x, y, z), body to world
+    static void rotation(const float q[4], float R[9]) {
+        const float w = q[0], x = q[1], y = q[2], z = q[3];
+        R[0] = 1.0f - 2.0f * (y * y + z * z);
+        R[1] = 2.0f * (x * y - w * z);
+        R[2] = 2.0f * (x * z + w * y);
+        R[3] = 2.0f * (x * y + w * z);
+        R[4] = 1.0f - 2.0f * (x * x + z * z);
+        R[5] = 2.0f * (y * z - w * x);
+        R[6] = 2.0f * (x * z - w * y);
+        R[7] = 2.0f * (y * z + w * x);
+        R[8] = 1.0f - 2.0f * (x * x + y * y);
+    }
+
+    static void multiply(const float M[9], const float x[3], float y[3]) {
+        for (int r = 0; r < 3; ++r) {
+            y[r] = M[3 * r] * x[0] + M[3 * r + 1] * x[1] + M[3 * r + 2] * x[2];
+        }
+    }
+
+    static void multiply3(const float A[9], const float B[9], float C[9]) {
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                C[3 * r + c] = A[3 * r] * B[c] + A[3 * r + 1] * B[3 + c] + A[3 * r + 2] * B[6 + c];
+            }
+        }
+    }
+
+    static bool invert(const float M[9], float inv[9]) {
+        inv[0] = M[4] * M[8] - M[5] * M[7];
+        inv[1] = M[2] * M[7] - M[1] * M[8];
+        inv[2] = M[1] * M[5] - M[2] * M[4];
+        inv[3] = M[5] * M[6] - M[3] * M[8];
+        inv[4] = M[0] * M[8] - M[2] * M[6];
+        inv[5] = M[2] * M[3] - M[0] * M[5];
+        inv[6] = M[3] * M[7] - M[4] * M[6];
+        inv[7] = M[1] * M[6] - M[0] * M[7];
+        inv[8] = M[0] * M[4] - M[1] * M[3];
+        const float det = M[0] * inv[0] + M[1] * inv[3] + M[2] * inv[6];
+        if (std::fabs(det) < 1e-12f) {
+            return false;
+        }
+        for (int i = 0; i < 9; ++i) {
+            inv[i] /= det;
+        }
+        return true;
+    }
+
+    BaseVelocityEstimatorConfig config_;
+    float v_[3] = {0.0f, 0.0f, 0.0f};
+    float P_[9] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    uint64_t stamp_ = 0;
+    uint64_t updates_ = 0;
+    SeqLock<BaseVelocityEstimate> published_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // BASE_VELOCITY_ESTIMATOR_H
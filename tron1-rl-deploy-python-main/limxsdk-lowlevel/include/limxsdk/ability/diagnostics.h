@@ -0,0 +1,293 @@
+/**
+ * @file diagnostics.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/apibase.h"
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @class DiagnosticRegistry
+ * @brief Process-wide table of interned diagnostic names and parts.
+ *
+ * Interning allocates once per distinct string; looking up an already
+ * interned string is a hash lookup without allocation.
+ */
+class LIMX_SDK_API DiagnosticRegistry {
+public:
+    enum : uint32_t { INVALID_ID = 0xFFFFFFFFu };
+
+    static DiagnosticRegistry& getInstance() {
+        static DiagnosticRegistry instance;
+        return instance;
+    }
+
+    uint32_t intern(const std::string& text) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = ids_.find(text);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(strings_.size());
+        strings_.push_back(text);
+        ids_.emplace(text, id);
+        return id;
+    }
+
+    /**
+     * @brief Returns the id of @p text, or INVALID_ID if it was never interned.
+     */
+    uint32_t find(const std::string& text) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = ids_.find(text);
+        return it == ids_.end() ? static_cast<uint32_t>(INVALID_ID) : it->second;
+    }
+
+    /**
+     * @brief Returns the string of @p id. Interned strings are never removed, so the reference stays valid.
+     */
+    const std::string& str(uint32_t id) const {
+        static const std::string empty;
+        std::lock_guard<std::mutex> lock(mutex_);
+        return id < strings_.size() ? strings_[id] : empty;
+    }
+
+private:
+    DiagnosticRegistry() = default;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::deque<std::string> strings_;   // Deque keeps references stable while growing
+};
+
+/**
+ * @class DiagnosticTemplate
+ * @brief A preformatted diagnostic with occurrence counting and rate limiting.
+ *
+ * All strings are built when the template is created, so publish() passes
+ * them by reference and allocates nothing itself. A template is one
+ * deduplication key: repeats within the minimum interval are counted as
+ * suppressed instead of being sent again. An interval of 0 disables the
+ * limit, e.g. for lifecycle events that must always be reported.
+ */
+class LIMX_SDK_API DiagnosticTemplate {
+public:
+    DiagnosticTemplate() : DiagnosticTemplate("", "", 0, DiagnosticValue::OK) {}
+
+    DiagnosticTemplate(const std::string& name, const std::string& part, int code, int level,
+                       const std::string& message = "", double minIntervalSec = 1.0)
+        : name_(name), part_(part), message_(message), code_(code), level_(level),
+          minIntervalNs_(static_cast<int64_t>(minIntervalSec * 1e9)), occurrences_(0), suppressed_(0),
+          lastPublishNs_(INT64_MIN) {
+        nameId_ = DiagnosticRegistry::getInstance().intern(name_);
+        partId_ = DiagnosticRegistry::getInstance().intern(part_);
+    }
+
+    DiagnosticTemplate(const DiagnosticTemplate& other)
+        : DiagnosticTemplate(other.name_, other.part_, other.code_, other.level_, other.message_,
+                             other.minIntervalNs_ / 1e9) {}
+
+    DiagnosticTemplate& operator=(const DiagnosticTemplate& other) {
+        if (this != &other) {
+            name_ = other.name_;
+            part_ = other.part_;
+            message_ = other.message_;
+            code_ = other.code_;
+            level_ = other.level_;
+            minIntervalNs_ = other.minIntervalNs_;
+            nameId_ = other.nameId_;
+            partId_ = other.partId_;
+            occurrences_ = 0;
+            suppressed_ = 0;
+            lastPublishNs_ = INT64_MIN;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Counts an occurrence and publishes it unless rate limited.
+     * @return True if the diagnostic was sent.
+     */
+    bool publish(ApiBase* robot) {
+        return publish(robot, message_);
+    }
+
+    /**
+     * @brief Same as publish(), with a message that differs from the template (e.g. an exception text).
+     *        The message does not take part in deduplication.
+     */
+    bool publish(ApiBase* robot, const std::string& message) {
+        occurrences_.fetch_add(1, std::memory_order_relaxed);
+        if (!admit()) {
+            suppressed_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        robot->publishDiagnostic(name_, part_, code_, level_, message);
+        return true;
+    }
+
+    uint32_t nameId() const { return nameId_; }
+    uint32_t partId() const { return partId_; }
+    const std::string& name() const { return name_; }
+    const std::string& part() const { return part_; }
+    int code() const { return code_; }
+    int level() const { return level_; }
+
+    uint64_t occurrences() const { return occurrences_.load(std::memory_order_relaxed); }
+    uint64_t suppressed() const { return suppressed_.load(std::memory_order_relaxed); }
+
+private:
+    bool admit() {
+        if (minIntervalNs_ <= 0) {
+            return true;
+        }
+        const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        int64_t last = lastPublishNs_.load(std::memory_order_relaxed);
+        // Only one of several concurrent publishers wins the slot
+        return (last == INT64_MIN || now - last >= minIntervalNs_) &&
+               lastPublishNs_.compare_exchange_strong(last, now, std::memory_order_relaxed);
+    }
+
+    std::string name_;
+    std::string part_;
+    std::string message_;
+    int code_;
+    int level_;
+    int64_t minIntervalNs_;
+    uint32_t nameId_;
+    uint32_t partId_;
+    std::atomic<uint64_t> occurrences_;
+    std::atomic<uint64_t> suppressed_;
+    std::atomic<int64_t> lastPublishNs_;
+};
+
+/**
+ * @class DiagnosticDispatcher
+ * @brief Routes incoming DiagnosticValue messages to handlers registered by interned name id.
+ *
+ * The dispatcher holds the only diagnostic subscription, so each message is
+ * hashed once instead of string-compared by every subscriber. Messages whose
+ * name nobody subscribed to are only counted.
+ *
+ * Subscribing copies the routing table and swaps in the copy, so dispatch()
+ * takes no lock for subscribed names and calls the handlers of an immutable
+ * snapshot; a handler may subscribe further handlers, which see the messages
+ * after the current one.
+ */
+class LIMX_SDK_API DiagnosticDispatcher {
+public:
+    typedef std::function<void(uint32_t nameId, const DiagnosticValue&)> Handler;
+
+    /**
+     * @brief Subscribes to the diagnostics of @p robot. Call once.
+     */
+    void attach(ApiBase* robot) {
+        robot->subscribeDiagnosticValue([this](const DiagnosticValueConstPtr& msg) { dispatch(*msg); });
+    }
+
+    /**
+     * @brief Registers @p handler for diagnostics named @p name and returns its id.
+     */
+    uint32_t subscribe(const std::string& name, Handler handler) {
+        const uint32_t id = DiagnosticRegistry::getInstance().intern(name);
+        subscribe(id, handler);
+        return id;
+    }
+
+    void subscribe(uint32_t nameId, Handler handler) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<Routes> next = std::make_shared<Routes>(*std::atomic_load(&routes_));
+        Route& route = next->handlers[nameId];
+        if (!route.count) {
+            route.count = std::make_shared<std::atomic<uint64_t>>(0);
+            next->ids[DiagnosticRegistry::getInstance().str(nameId)] = nameId;
+        }
+        route.handlers.push_back(handler);
+        std::atomic_store(&routes_, std::shared_ptr<const Routes>(next));
+    }
+
+    /**
+     * @brief Registers @p handler for every diagnostic, including names that were never interned.
+     */
+    void subscribeAll(Handler handler) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::shared_ptr<Routes> next = std::make_shared<Routes>(*std::atomic_load(&routes_));
+        next->catchAll.push_back(handler);
+        std::atomic_store(&routes_, std::shared_ptr<const Routes>(next));
+    }
+
+    void dispatch(const DiagnosticValue& msg) {
+        const std::shared_ptr<const Routes> routes = std::atomic_load(&routes_);
+        // Subscribed names resolve in the snapshot; only catch-all handlers need the registry for others
+        auto named = routes->ids.find(msg.name);
+        const uint32_t id = named != routes->ids.end() ? named->second
+                            : routes->catchAll.empty() ? static_cast<uint32_t>(DiagnosticRegistry::INVALID_ID)
+                                                       : DiagnosticRegistry::getInstance().find(msg.name);
+        for (auto& handler : routes->catchAll) {
+            handler(id, msg);
+        }
+        auto it = named == routes->ids.end() ? routes->handlers.end() : routes->handlers.find(id);
+        if (it == routes->handlers.end()) {
+            unknown_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        it->second.count->fetch_add(1, std::memory_order_relaxed);
+        for (auto& handler : it->second.handlers) {
+            handler(id, msg);
+        }
+    }
+
+    /**
+     * @brief Number of diagnostics received for a subscribed name id.
+     */
+    uint64_t count(uint32_t nameId) const {
+        const std::shared_ptr<const Routes> routes = std::atomic_load(&routes_);
+        auto it = routes->handlers.find(nameId);
+        return it == routes->handlers.end() ? 0 : it->second.count->load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of diagnostics received for names without a handler.
+     */
+    uint64_t unhandledCount() const { return unknown_.load(std::memory_order_relaxed); }
+
+private:
+    struct Route {
+        std::shared_ptr<std::atomic<uint64_t>> count;  // Shared by the snapshots
+        std::vector<Handler> handlers;
+    };
+
+    struct Routes {
+        std::unordered_map<uint32_t, Route> handlers;
+        std::unordered_map<std::string, uint32_t> ids;  // Names of the handlers
+        std::vector<Handler> catchAll;
+    };
+
+    std::mutex mutex_;  // Serializes subscribers; dispatch() only loads the snapshot
+    std::shared_ptr<const Routes> routes_ = std::make_shared<Routes>();
+    std::atomic<uint64_t> unknown_{0};
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // DIAGNOSTICS_H
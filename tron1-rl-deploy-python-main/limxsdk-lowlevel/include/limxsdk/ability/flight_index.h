@@ -0,0 +1,305 @@
+/**
+ * @file flight_index.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef FLIGHT_INDEX_H
+#define FLIGHT_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/ability/flight_log.h"
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @brief One sparse index point: the first record at or after @p time.
+ */
+struct LIMX_SDK_API FlightIndexEntry {
+    uint64_t time;
+    uint32_t segment;   // Segment number, see FlightLogIndex::segmentPath()
+    uint32_t reserved;
+    uint64_t offset;    // Record offset inside the segment file
+};
+
+/**
+ * @class FlightLogIndex
+ * @brief Sparse time index over the segments of a recording.
+ *
+ * Records are written in capture-time order, so an index point every
+ * interval nanoseconds bounds the linear scan after a binary search. The
+ * index is stored as flight.idx next to the segments and rebuilt when the
+ * segments it describes have changed.
+ */
+class LIMX_SDK_API FlightLogIndex {
+public:
+    static const uint64_t DEFAULT_INTERVAL_NS = 50000000;  // 50 ms
+
+    /**
+     * @brief Loads directory/flight.idx, or rebuilds and saves it if missing or stale.
+     */
+    bool loadOrBuild(const std::string& directory, uint64_t intervalNs = DEFAULT_INTERVAL_NS) {
+        if (load(directory) && !isStale()) {
+            return true;
+        }
+        if (!build(directory, intervalNs)) {
+            return false;
+        }
+        if (!save()) {
+            std::cerr << "Failed to save flight log index: " << indexPath(directory) << std::endl;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Scans all segments of @p directory and builds the index in memory.
+     */
+    bool build(const std::string& directory, uint64_t intervalNs = DEFAULT_INTERVAL_NS) {
+        directory_ = directory;
+        intervalNs_ = intervalNs;
+        segments_.clear();
+        entries_.clear();
+
+        std::vector<std::string> paths = flight_log::listSegments(directory);
+        for (size_t i = 0; i < paths.size(); ++i) {
+            FlightSegmentReader reader;
+            if (!reader.open(paths[i])) {
+                continue;
+            }
+            Segment segment;
+            segment.path = paths[i];
+            segment.used = reader.header().used;
+            segment.firstTime = reader.header().first_time;
+            segment.lastTime = reader.header().last_time;
+            const uint32_t segmentId = static_cast<uint32_t>(segments_.size());
+            segments_.push_back(segment);
+
+            FlightRecordView record;
+            uint64_t nextTime = 0;
+            bool first = true;
+            while (reader.next(record)) {
+                // Every segment starts with an index point so a seek never crosses a file boundary backwards
+                if (first || record.time() >= nextTime) {
+                    FlightIndexEntry entry;
+                    entry.time = record.time();
+                    entry.segment = segmentId;
+                    entry.reserved = 0;
+                    entry.offset = record.offset;
+                    entries_.push_back(entry);
+                    nextTime = record.time() + intervalNs_;
+                    first = false;
+                }
+            }
+        }
+        return !segments_.empty();
+    }
+
+    bool save() const {
+        std::ofstream out(indexPath(directory_), std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return false;
+        }
+        FileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = FileHeader::MAGIC;
+        header.version = FileHeader::VERSION;
+        header.intervalNs = intervalNs_;
+        header.segmentCount = segments_.size();
+        header.entryCount = entries_.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& segment : segments_) {
+            FileSegment record;
+            std::memset(&record, 0, sizeof(record));
+            std::strncpy(record.name, baseName(segment.path).c_str(), sizeof(record.name) - 1);
+            record.used = segment.used;
+            record.firstTime = segment.firstTime;
+            record.lastTime = segment.lastTime;
+            out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        }
+        out.write(reinterpret_cast<const char*>(entries_.data()), entries_.size() * sizeof(FlightIndexEntry));
+        return static_cast<bool>(out);
+    }
+
+    bool load(const std::string& directory) {
+        directory_ = directory;
+        segments_.clear();
+        entries_.clear();
+
+        std::ifstream in(indexPath(directory), std::ios::binary);
+        FileHeader header;
+        if (!in || !in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != FileHeader::MAGIC || header.version != FileHeader::VERSION) {
+            return false;
+        }
+        intervalNs_ = header.intervalNs;
+        for (uint64_t i = 0; i < header.segmentCount; ++i) {
+            FileSegment record;
+            if (!in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+                return false;
+            }
+            record.name[sizeof(record.name) - 1] = '\0';
+            Segment segment;
+            segment.path = directory + "/" + record.name;
+            segment.used = record.used;
+            segment.firstTime = record.firstTime;
+            segment.lastTime = record.lastTime;
+            segments_.push_back(segment);
+        }
+        entries_.resize(header.entryCount);
+        if (!in.read(reinterpret_cast<char*>(entries_.data()), entries_.size() * sizeof(FlightIndexEntry))) {
+            entries_.clear();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief True if segments were added, removed or have grown since the index was built.
+     */
+    bool isStale() const {
+        std::vector<std::string> paths = flight_log::listSegments(directory_);
+        size_t matched = 0;
+        for (size_t i = 0; i < paths.size(); ++i) {
+            FlightSegmentReader reader;
+            if (!reader.open(paths[i])) {
+                continue;  // Skipped by build() as well
+            }
+            // Both lists are in name order, so every readable segment must be the next indexed one
+            if (matched == segments_.size() || baseName(paths[i]) != baseName(segments_[matched].path) ||
+                reader.header().used != segments_[matched].used) {
+                return true;
+            }
+            ++matched;
+        }
+        return matched != segments_.size();
+    }
+
+    /**
+     * @brief Finds the index point at or before @p time in O(log n).
+     * @return Nullptr if the index is empty; the first entry if @p time precedes the recording.
+     */
+    const FlightIndexEntry* lookup(uint64_t time) const {
+        if (entries_.empty()) {
+            return nullptr;
+        }
+        auto it = std::upper_bound(entries_.begin(), entries_.end(), time,
+                                   [](uint64_t t, const FlightIndexEntry& entry) { return t < entry.time; });
+        return it == entries_.begin() ? &entries_.front() : &*(it - 1);
+    }
+
+    uint64_t startTime() const { return entries_.empty() ? 0 : entries_.front().time; }
+    uint64_t endTime() const { return segments_.empty() ? 0 : segments_.back().lastTime; }
+    size_t segmentCount() const { return segments_.size(); }
+    const std::string& segmentPath(size_t i) const { return segments_[i].path; }
+    const std::vector<FlightIndexEntry>& entries() const { return entries_; }
+
+    static std::string indexPath(const std::string& directory) { return directory + "/flight.idx"; }
+
+private:
+    struct Segment {
+        std::string path;
+        uint64_t used;
+        uint64_t firstTime;
+        uint64_t lastTime;
+    };
+
+    struct FileHeader {
+        enum : uint32_t { MAGIC = 0x5844494C, VERSION = 1 };  // "LIDX"
+        uint32_t magic;
+        uint32_t version;
+        uint64_t intervalNs;
+        uint64_t segmentCount;
+        uint64_t entryCount;
+    };
+
+    struct FileSegment {
+        char name[64];
+        uint64_t used;
+        uint64_t firstTime;
+        uint64_t lastTime;
+    };
+
+    static std::string baseName(const std::string& path) {
+        size_t pos = path.find_last_of("/\\");
+        return pos == std::string::npos ? path : path.substr(pos + 1);
+    }
+
+    std::string directory_;
+    uint64_t intervalNs_ = DEFAULT_INTERVAL_NS;
+    std::vector<Segment> segments_;
+    std::vector<FlightIndexEntry> entries_;
+};
+
+/**
+ * @class FlightLogCursor
+ * @brief Iterates the records of a whole recording, crossing segment boundaries.
+ */
+class LIMX_SDK_API FlightLogCursor {
+public:
+    explicit FlightLogCursor(const FlightLogIndex& index) : index_(index), segment_(0) {}
+
+    /**
+     * @brief Positions the cursor on the first record with time >= @p time.
+     * @return False if no such record exists.
+     */
+    bool seek(uint64_t time) {
+        const FlightIndexEntry* entry = index_.lookup(time);
+        if (!entry || !openSegment(entry->segment) || !reader_.seek(entry->offset)) {
+            return false;
+        }
+        // Skip the few records between the index point and the requested time
+        FlightRecordView record;
+        while (next(record)) {
+            if (record.time() >= time) {
+                return reader_.seek(record.offset);
+            }
+        }
+        return false;
+    }
+
+    bool rewind() { return openSegment(0); }
+
+    bool next(FlightRecordView& record) {
+        while (reader_.isOpen()) {
+            if (reader_.next(record)) {
+                return true;
+            }
+            if (segment_ + 1 >= index_.segmentCount() || !openSegment(segment_ + 1)) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+private:
+    bool openSegment(size_t segment) {
+        if (segment >= index_.segmentCount()) {
+            return false;
+        }
+        if (segment != segment_ || !reader_.isOpen()) {
+            if (!reader_.open(index_.segmentPath(segment))) {
+                return false;
+            }
+            segment_ = segment;
+        }
+        reader_.rewind();
+        return true;
+    }
+
+    const FlightLogIndex& index_;
+    size_t segment_;
+    FlightSegmentReader reader_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // FLIGHT_INDEX_H
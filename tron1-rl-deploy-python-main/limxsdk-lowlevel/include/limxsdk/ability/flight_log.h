@@ -0,0 +1,515 @@
+/**
+ * @file flight_log.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef FLIGHT_LOG_H
+#define FLIGHT_LOG_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <dirent.h>
+#endif
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * Binary flight log format.
+ *
+ * A recording is a directory of segment files (flight_000000.seg, ...). Each
+ * segment starts with a FlightSegmentHeader padded to HEADER_SIZE bytes,
+ * followed by back-to-back records. Every record starts with a
+ * FlightRecordHeader whose size covers header and payload and is a multiple
+ * of 8. Record times are steady-clock nanoseconds taken when the message was
+ * captured; the original message stamp is kept inside the payload.
+ */
+enum FlightRecordType : uint16_t {
+    FLIGHT_RECORD_IMU_DATA = 1,
+    FLIGHT_RECORD_ROBOT_STATE = 2,
+    FLIGHT_RECORD_ROBOT_CMD = 3,
+    FLIGHT_RECORD_SENSOR_JOY = 4,
+    FLIGHT_RECORD_DIAGNOSTIC = 5,
+};
+
+struct LIMX_SDK_API FlightRecordHeader {
+    uint16_t type;      // FlightRecordType
+    uint16_t reserved;
+    uint32_t size;      // Header plus payload, multiple of 8
+    uint64_t time;      // Capture time, steady clock nanoseconds
+};
+
+struct LIMX_SDK_API FlightSegmentHeader {
+    enum : uint32_t { MAGIC = 0x52464C4C, VERSION = 1, HEADER_SIZE = 4096 };
+
+    uint32_t magic;
+    uint32_t version;
+    uint64_t segment_index;     // Position of the segment in its recording
+    uint64_t capacity;          // Bytes available for records after the header
+    uint64_t used;              // Bytes of valid records after the header
+    uint64_t record_count;
+    uint64_t first_time;        // Time of the first record, 0 if empty
+    uint64_t last_time;         // Time of the last record
+    int64_t wall_time_offset;   // system_clock - steady_clock in nanoseconds at creation
+};
+
+/**
+ * @brief Fixed-size captures of the recorded streams.
+ *
+ * These are the elements of the recorder rings: they hold a message without
+ * any heap allocation so capturing is a bounded copy.
+ */
+struct LIMX_SDK_API FlightCapture {
+    enum { MAX_MOTORS = 32, MAX_AXES = 16, MAX_BUTTONS = 32, MAX_TEXT = 96 };
+};
+
+struct LIMX_SDK_API ImuCapture {
+    uint64_t time;
+    uint64_t stamp;
+    float acc[3];
+    float gyro[3];
+    float quat[4];
+};
+
+struct LIMX_SDK_API RobotStateCapture {
+    uint64_t time;
+    uint64_t stamp;
+    uint32_t motor_num;
+    float tau[FlightCapture::MAX_MOTORS];
+    float q[FlightCapture::MAX_MOTORS];
+    float dq[FlightCapture::MAX_MOTORS];
+};
+
+struct LIMX_SDK_API RobotCmdCapture {
+    uint64_t time;
+    uint64_t stamp;
+    uint32_t motor_num;
+    uint8_t mode[FlightCapture::MAX_MOTORS];
+    float q[FlightCapture::MAX_MOTORS];
+    float dq[FlightCapture::MAX_MOTORS];
+    float tau[FlightCapture::MAX_MOTORS];
+    float Kp[FlightCapture::MAX_MOTORS];
+    float Kd[FlightCapture::MAX_MOTORS];
+};
+
+struct LIMX_SDK_API SensorJoyCapture {
+    uint64_t time;
+    uint64_t stamp;
+    uint32_t axes_num;
+    uint32_t buttons_num;
+    float axes[FlightCapture::MAX_AXES];
+    int32_t buttons[FlightCapture::MAX_BUTTONS];
+};
+
+struct LIMX_SDK_API DiagnosticCapture {
+    uint64_t time;
+    uint64_t stamp;
+    int32_t level;
+    int32_t code;
+    char name[FlightCapture::MAX_TEXT];
+    char message[FlightCapture::MAX_TEXT];
+};
+
+namespace flight_log {
+
+inline uint32_t align8(uint32_t size) { return (size + 7u) & ~7u; }
+
+template <typename T>
+inline uint8_t* put(uint8_t* dst, const T* src, size_t count) {
+    std::memcpy(dst, src, sizeof(T) * count);
+    return dst + sizeof(T) * count;
+}
+
+template <typename T>
+inline const uint8_t* get(const uint8_t* src, T* dst, size_t count) {
+    std::memcpy(dst, src, sizeof(T) * count);
+    return src + sizeof(T) * count;
+}
+
+// Encoded record sizes, header included
+inline uint32_t encodedSize(const ImuCapture&) {
+    return align8(sizeof(FlightRecordHeader) + 8 + 10 * sizeof(float));
+}
+inline uint32_t encodedSize(const RobotStateCapture& c) {
+    return align8(sizeof(FlightRecordHeader) + 16 + 3 * sizeof(float) * c.motor_num);
+}
+inline uint32_t encodedSize(const RobotCmdCapture& c) {
+    return align8(sizeof(FlightRecordHeader) + 16 + 5 * sizeof(float) * c.motor_num + c.motor_num);
+}
+inline uint32_t encodedSize(const SensorJoyCapture& c) {
+    return align8(sizeof(FlightRecordHeader) + 16 + sizeof(float) * c.axes_num + sizeof(int32_t) * c.buttons_num);
+}
+inline uint32_t encodedSize(const DiagnosticCapture& c) {
+    return align8(sizeof(FlightRecordHeader) + 24 +
+                  static_cast<uint32_t>(strnlen(c.name, sizeof(c.name)) + strnlen(c.message, sizeof(c.message))));
+}
+
+inline uint8_t* putHeader(uint8_t* dst, uint16_t type, uint32_t size, uint64_t time) {
+    FlightRecordHeader header;
+    header.type = type;
+    header.reserved = 0;
+    header.size = size;
+    header.time = time;
+    std::memset(dst, 0, size);
+    return put(dst, &header, 1);
+}
+
+// Record encoders; dst must provide encodedSize() bytes. Return the encoded size.
+inline uint32_t encode(const ImuCapture& c, uint8_t* dst) {
+    const uint32_t size = encodedSize(c);
+    uint8_t* p = putHeader(dst, FLIGHT_RECORD_IMU_DATA, size, c.time);
+    p = put(p, &c.stamp, 1);
+    p = put(p, c.acc, 3);
+    p = put(p, c.gyro, 3);
+    put(p, c.quat, 4);
+    return size;
+}
+
+inline uint32_t encode(const RobotStateCapture& c, uint8_t* dst) {
+    const uint32_t size = encodedSize(c);
+    const uint32_t pad = 0;
+    uint8_t* p = putHeader(dst, FLIGHT_RECORD_ROBOT_STATE, size, c.time);
+    p = put(p, &c.stamp, 1);
+    p = put(p, &c.motor_num, 1);
+    p = put(p, &pad, 1);
+    p = put(p, c.tau, c.motor_num);
+    p = put(p, c.q, c.motor_num);
+    put(p, c.dq, c.motor_num);
+    return size;
+}
+
+inline uint32_t encode(const RobotCmdCapture& c, uint8_t* dst) {
+    const uint32_t size = encodedSize(c);
+    const uint32_t pad = 0;
+    uint8_t* p = putHeader(dst, FLIGHT_RECORD_ROBOT_CMD, size, c.time);
+    p = put(p, &c.stamp, 1);
+    p = put(p, &c.motor_num, 1);
+    p = put(p, &pad, 1);
+    p = put(p, c.q, c.motor_num);
+    p = put(p, c.dq, c.motor_num);
+    p = put(p, c.tau, c.motor_num);
+    p = put(p, c.Kp, c.motor_num);
+    p = put(p, c.Kd, c.motor_num);
+    put(p, c.mode, c.motor_num);
+    return size;
+}
+
+inline uint32_t encode(const SensorJoyCapture& c, uint8_t* dst) {
+    const uint32_t size = encodedSize(c);
+    uint8_t* p = putHeader(dst, FLIGHT_RECORD_SENSOR_JOY, size, c.time);
+    p = put(p, &c.stamp, 1);
+    p = put(p, &c.axes_num, 1);
+    p = put(p, &c.buttons_num, 1);
+    p = put(p, c.axes, c.axes_num);
+    put(p, c.buttons, c.buttons_num);
+    return size;
+}
+
+inline uint32_t encode(const DiagnosticCapture& c, uint8_t* dst) {
+    const uint32_t size = encodedSize(c);
+    const uint32_t nameLen = static_cast<uint32_t>(strnlen(c.name, sizeof(c.name)));
+    const uint32_t messageLen = static_cast<uint32_t>(strnlen(c.message, sizeof(c.message)));
+    uint8_t* p = putHeader(dst, FLIGHT_RECORD_DIAGNOSTIC, size, c.time);
+    p = put(p, &c.stamp, 1);
+    p = put(p, &c.level, 1);
+    p = put(p, &c.code, 1);
+    p = put(p, &nameLen, 1);
+    p = put(p, &messageLen, 1);
+    p = put(p, c.name, nameLen);
+    put(p, c.message, messageLen);
+    return size;
+}
+
+} // namespace flight_log
+
+/**
+ * @brief A record inside a mapped segment.
+ */
+struct LIMX_SDK_API FlightRecordView {
+    const FlightRecordHeader* header;
+    const uint8_t* payload;
+    uint64_t offset;    // Offset of the record header from the start of the segment file
+
+    uint16_t type() const { return header->type; }
+    uint64_t time() const { return header->time; }
+
+    // Decoders; return false if the record is of another type or malformed
+    bool decode(ImuData& out) const {
+        if (header->type != FLIGHT_RECORD_IMU_DATA) {
+            return false;
+        }
+        const uint8_t* p = flight_log::get(payload, &out.stamp, 1);
+        p = flight_log::get(p, out.acc, 3);
+        p = flight_log::get(p, out.gyro, 3);
+        flight_log::get(p, out.quat, 4);
+        return true;
+    }
+
+    bool decode(RobotState& out) const {
+        if (header->type != FLIGHT_RECORD_ROBOT_STATE) {
+            return false;
+        }
+        uint32_t motorNum = 0;
+        const uint8_t* p = flight_log::get(payload, &out.stamp, 1);
+        p = flight_log::get(p, &motorNum, 1);
+        if (sizeof(FlightRecordHeader) + 16 + 3 * sizeof(float) * motorNum > header->size) {
+            return false;
+        }
+        p += 4;
+        out.tau.resize(motorNum);
+        out.q.resize(motorNum);
+        out.dq.resize(motorNum);
+        out.motor_names.resize(motorNum);
+        p = flight_log::get(p, out.tau.data(), motorNum);
+        p = flight_log::get(p, out.q.data(), motorNum);
+        flight_log::get(p, out.dq.data(), motorNum);
+        return true;
+    }
+
+    bool decode(RobotCmd& out) const {
+        if (header->type != FLIGHT_RECORD_ROBOT_CMD) {
+            return false;
+        }
+        uint32_t motorNum = 0;
+        const uint8_t* p = flight_log::get(payload, &out.stamp, 1);
+        p = flight_log::get(p, &motorNum, 1);
+        if (sizeof(FlightRecordHeader) + 16 + 5 * sizeof(float) * motorNum + motorNum > header->size) {
+            return false;
+        }
+        p += 4;
+        out.resize(motorNum);
+        p = flight_log::get(p, out.q.data(), motorNum);
+        p = flight_log::get(p, out.dq.data(), motorNum);
+        p = flight_log::get(p, out.tau.data(), motorNum);
+        p = flight_log::get(p, out.Kp.data(), motorNum);
+        p = flight_log::get(p, out.Kd.data(), motorNum);
+        flight_log::get(p, out.mode.data(), motorNum);
+        return true;
+    }
+
+    bool decode(SensorJoy& out) const {
+        if (header->type != FLIGHT_RECORD_SENSOR_JOY) {
+            return false;
+        }
+        uint32_t axesNum = 0, buttonsNum = 0;
+        const uint8_t* p = flight_log::get(payload, &out.stamp, 1);
+        p = flight_log::get(p, &axesNum, 1);
+        p = flight_log::get(p, &buttonsNum, 1);
+        if (sizeof(FlightRecordHeader) + 16 + sizeof(float) * axesNum + sizeof(int32_t) * buttonsNum > header->size) {
+            return false;
+        }
+        out.axes.resize(axesNum);
+        out.buttons.resize(buttonsNum);
+        p = flight_log::get(p, out.axes.data(), axesNum);
+        flight_log::get(p, out.buttons.data(), buttonsNum);
+        return true;
+    }
+
+    bool decode(DiagnosticValue& out) const {
+        if (header->type != FLIGHT_RECORD_DIAGNOSTIC) {
+            return false;
+        }
+        uint32_t nameLen = 0, messageLen = 0;
+        const uint8_t* p = flight_log::get(payload, &out.stamp, 1);
+        p = flight_log::get(p, &out.level, 1);
+        p = flight_log::get(p, &out.code, 1);
+        p = flight_log::get(p, &nameLen, 1);
+        p = flight_log::get(p, &messageLen, 1);
+        if (sizeof(FlightRecordHeader) + 24 + nameLen + messageLen > header->size) {
+            return false;
+        }
+        out.name.assign(reinterpret_cast<const char*>(p), nameLen);
+        out.message.assign(reinterpret_cast<const char*>(p + nameLen), messageLen);
+        return true;
+    }
+};
+
+/**
+ * @class FlightSegmentReader
+ * @brief Maps one segment file read-only and iterates its records.
+ *
+ * Segments that are still being written can be read; only records published
+ * through the header's used counter are visible.
+ */
+class LIMX_SDK_API FlightSegmentReader {
+public:
+    FlightSegmentReader() : data_(nullptr), size_(0), cursor_(0) {}
+    ~FlightSegmentReader() { close(); }
+
+    FlightSegmentReader(const FlightSegmentReader&) = delete;
+    FlightSegmentReader& operator=(const FlightSegmentReader&) = delete;
+
+    bool open(const std::string& path) {
+        close();
+#ifdef _WIN32
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            return false;
+        }
+        buffer_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(FlightSegmentHeader::HEADER_SIZE)) {
+            ::close(fd);
+            return false;
+        }
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        data_ = static_cast<const uint8_t*>(addr);
+        size_ = static_cast<size_t>(st.st_size);
+#endif
+        if (size_ < FlightSegmentHeader::HEADER_SIZE || header().magic != FlightSegmentHeader::MAGIC ||
+            header().version != FlightSegmentHeader::VERSION) {
+            std::cerr << "Not a flight log segment: " << path << std::endl;
+            close();
+            return false;
+        }
+        path_ = path;
+        rewind();
+        return true;
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (data_) {
+            munmap(const_cast<uint8_t*>(data_), size_);
+        }
+#endif
+        buffer_.clear();
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    bool isOpen() const { return data_ != nullptr; }
+    const std::string& path() const { return path_; }
+    const FlightSegmentHeader& header() const { return *reinterpret_cast<const FlightSegmentHeader*>(data_); }
+
+    // End offset of the valid records
+    uint64_t end() const {
+#ifdef _WIN32
+        uint64_t used = header().used;
+#else
+        uint64_t used = __atomic_load_n(&header().used, __ATOMIC_ACQUIRE);
+#endif
+        return std::min<uint64_t>(FlightSegmentHeader::HEADER_SIZE + used, size_);
+    }
+
+    void rewind() { cursor_ = FlightSegmentHeader::HEADER_SIZE; }
+
+    /**
+     * @brief Positions the cursor at a record offset, e.g. one taken from an index.
+     */
+    bool seek(uint64_t offset) {
+        if (offset < FlightSegmentHeader::HEADER_SIZE || offset > end() || (offset & 7u) != 0) {
+            return false;
+        }
+        cursor_ = offset;
+        return true;
+    }
+
+    uint64_t tell() const { return cursor_; }
+
+    /**
+     * @brief Reads the record at the cursor and advances.
+     * @return False at the end of the segment or on a corrupt record.
+     */
+    bool next(FlightRecordView& view) {
+        const uint64_t limit = end();
+        if (cursor_ + sizeof(FlightRecordHeader) > limit) {
+            return false;
+        }
+        const FlightRecordHeader* header = reinterpret_cast<const FlightRecordHeader*>(data_ + cursor_);
+        if (header->size < sizeof(FlightRecordHeader) || (header->size & 7u) != 0 || cursor_ + header->size > limit) {
+            return false;
+        }
+        view.header = header;
+        view.payload = data_ + cursor_ + sizeof(FlightRecordHeader);
+        view.offset = cursor_;
+        cursor_ += header->size;
+        return true;
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    uint64_t cursor_;
+    std::vector<uint8_t> buffer_;
+    std::string path_;
+};
+
+namespace flight_log {
+
+/**
+ * @brief True for file names written by the recorder, flight_*.seg; dumps and exports are skipped.
+ */
+inline bool isSegmentName(const std::string& name) {
+    return name.size() > 11 && name.compare(0, 7, "flight_") == 0 && name.compare(name.size() - 4, 4, ".seg") == 0;
+}
+
+/**
+ * @brief Lists the segment files (flight_*.seg) of a recording directory in recording order.
+ */
+inline std::vector<std::string> listSegments(const std::string& directory) {
+    std::vector<std::string> files;
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((directory + "\\flight_*.seg").c_str(), &data);
+    if (handle != INVALID_HANDLE_VALUE) {
+        do {
+            // The pattern also matches longer extensions through their short names
+            if (isSegmentName(data.cFileName)) {
+                files.push_back(directory + "\\" + data.cFileName);
+            }
+        } while (FindNextFileA(handle, &data));
+        FindClose(handle);
+    }
+#else
+    DIR* dir = opendir(directory.c_str());
+    if (dir) {
+        while (dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (isSegmentName(name)) {
+                files.push_back(directory + "/" + name);
+            }
+        }
+        closedir(dir);
+    }
+#endif
+    // Segment names carry a zero-padded index, so lexical order is recording order
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+} // namespace flight_log
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // FLIGHT_LOG_H
@@ -0,0 +1,604 @@
+/**
+ * @file flight_recorder.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/apibase.h"
+#include "limxsdk/ability/spsc_ring.h"
+#include "limxsdk/ability/flight_log.h"
+
+#ifndef _WIN32
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace limxsdk {
+namespace ability {
+
+struct LIMX_SDK_API FlightRecorderConfig {
+    std::string directory;          // Root directory; each session gets a timestamped subdirectory
+    size_t segmentSizeMb = 64;      // Preallocated size of one segment file
+    size_t maxSegments = 16;        // Oldest segments are deleted beyond this count
+    double dumpSeconds = 10.0;      // Window copied into a dump file on an error diagnostic
+    bool dumpOnError = true;
+};
+
+struct LIMX_SDK_API FlightRecorderStats {
+    uint64_t records;       // Records written to segments
+    uint64_t bytes;         // Bytes written to segments
+    uint64_t dropped;       // Messages lost to full rings, producer contention or write errors
+    uint64_t segments;      // Segments opened in this session
+    uint64_t dumps;         // Dump files written
+};
+
+/**
+ * @class FlightRecorder
+ * @brief Records robot streams at full rate into rotating binary segment files.
+ *
+ * Producers (SDK callbacks, RobotCmd publishers) copy each message into a
+ * fixed-size slot of a per-stream SPSC ring and return; they never allocate,
+ * lock or touch the file system. If two threads feed the same stream at once,
+ * the loser drops its message instead of waiting. A writer thread at reduced
+ * priority merges the rings in capture-time order into a preallocated,
+ * memory-mapped segment and rotates to a new one when it is full.
+ *
+ * The on-disk format is described in flight_log.h.
+ */
+class LIMX_SDK_API FlightRecorder {
+public:
+    FlightRecorder()
+        : recording_(false), running_(false), dumpRequest_(0), lastDumpTime_(0), written_(0), bytes_(0),
+          writeErrors_(0), segmentCount_(0), dumpCount_(0), wallTimeOffset_(0), segmentIndex_(0),
+          segmentFd_(-1), segmentBase_(nullptr), segmentHeader_(nullptr) {}
+
+    ~FlightRecorder() { stop(); }
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * @brief Creates the session directory and starts the writer thread.
+     * @return False if the directory or the first segment cannot be created.
+     */
+    bool start(const FlightRecorderConfig& config) {
+#ifdef _WIN32
+        std::cerr << "Flight recorder is not supported on this platform" << std::endl;
+        return false;
+#else
+        if (running_) {
+            return true;
+        }
+        config_ = config;
+        config_.maxSegments = std::max<size_t>(config_.maxSegments, 2);
+        config_.segmentSizeMb = std::max<size_t>(config_.segmentSizeMb, 1);
+
+        char session[32];
+        std::time_t now = std::time(nullptr);
+        std::strftime(session, sizeof(session), "%Y%m%d_%H%M%S", std::localtime(&now));
+        sessionDir_ = config_.directory + "/" + session;
+        if (!makeDirectories(sessionDir_)) {
+            std::cerr << "Failed to create flight recorder directory: " << sessionDir_ << std::endl;
+            return false;
+        }
+
+        wallTimeOffset_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count() - static_cast<int64_t>(nowNs());
+        if (!openSegment()) {
+            return false;
+        }
+
+        running_ = true;
+        recording_ = true;
+        writerThread_ = std::thread(&FlightRecorder::writerLoop, this);
+        std::cout << "Flight recorder writing to " << sessionDir_ << std::endl;
+        return true;
+#endif
+    }
+
+    /**
+     * @brief Stops capturing, flushes the rings and closes the current segment.
+     */
+    void stop() {
+        recording_ = false;
+        running_ = false;
+        if (writerThread_.joinable()) {
+            writerThread_.join();
+        }
+    }
+
+    bool isRecording() const { return recording_; }
+    const std::string& sessionDirectory() const { return sessionDir_; }
+
+    /**
+     * @brief Subscribes the recorder to the state, IMU, joystick and diagnostic streams of @p robot.
+     *
+     * The SDK has no unsubscribe, so the recorder must outlive the robot callbacks.
+     */
+    void attach(ApiBase* robot) {
+        robot->subscribeRobotState([this](const RobotStateConstPtr& msg) { recordRobotState(*msg); });
+        robot->subscribeImuData([this](const ImuDataConstPtr& msg) { recordImuData(*msg); });
+        robot->subscribeSensorJoy([this](const SensorJoyConstPtr& msg) { recordSensorJoy(*msg); });
+        robot->subscribeDiagnosticValue([this](const DiagnosticValueConstPtr& msg) { recordDiagnostic(*msg); });
+    }
+
+    void recordRobotState(const RobotState& msg) {
+        if (!recording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        RobotStateCapture* slot = state_.begin();
+        if (!slot) {
+            return;
+        }
+        slot->time = nowNs();
+        slot->stamp = msg.stamp;
+        slot->motor_num = clampCount(msg.q.size(), FlightCapture::MAX_MOTORS);
+        copyN(msg.tau, slot->tau, slot->motor_num);
+        copyN(msg.q, slot->q, slot->motor_num);
+        copyN(msg.dq, slot->dq, slot->motor_num);
+        state_.end();
+    }
+
+    void recordRobotCmd(const RobotCmd& msg) {
+        if (!recording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        RobotCmdCapture* slot = cmd_.begin();
+        if (!slot) {
+            return;
+        }
+        slot->time = nowNs();
+        slot->stamp = msg.stamp;
+        slot->motor_num = clampCount(msg.q.size(), FlightCapture::MAX_MOTORS);
+        copyN(msg.mode, slot->mode, slot->motor_num);
+        copyN(msg.q, slot->q, slot->motor_num);
+        copyN(msg.dq, slot->dq, slot->motor_num);
+        copyN(msg.tau, slot->tau, slot->motor_num);
+        copyN(msg.Kp, slot->Kp, slot->motor_num);
+        copyN(msg.Kd, slot->Kd, slot->motor_num);
+        cmd_.end();
+    }
+
+    void recordImuData(const ImuData& msg) {
+        if (!recording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        ImuCapture* slot = imu_.begin();
+        if (!slot) {
+            return;
+        }
+        slot->time = nowNs();
+        slot->stamp = msg.stamp;
+        std::memcpy(slot->acc, msg.acc, sizeof(slot->acc));
+        std::memcpy(slot->gyro, msg.gyro, sizeof(slot->gyro));
+        std::memcpy(slot->quat, msg.quat, sizeof(slot->quat));
+        imu_.end();
+    }
+
+    void recordSensorJoy(const SensorJoy& msg) {
+        if (!recording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        SensorJoyCapture* slot = joy_.begin();
+        if (!slot) {
+            return;
+        }
+        slot->time = nowNs();
+        slot->stamp = msg.stamp;
+        slot->axes_num = clampCount(msg.axes.size(), FlightCapture::MAX_AXES);
+        slot->buttons_num = clampCount(msg.buttons.size(), FlightCapture::MAX_BUTTONS);
+        copyN(msg.axes, slot->axes, slot->axes_num);
+        copyN(msg.buttons, slot->buttons, slot->buttons_num);
+        joy_.end();
+    }
+
+    /**
+     * @brief Records a diagnostic; an ERROR level diagnostic also requests a dump.
+     */
+    void recordDiagnostic(const DiagnosticValue& msg) {
+        if (!recording_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        DiagnosticCapture* slot = diag_.begin();
+        if (slot) {
+            slot->time = nowNs();
+            slot->stamp = msg.stamp;
+            slot->level = msg.level;
+            slot->code = msg.code;
+            copyText(msg.name, slot->name, sizeof(slot->name));
+            copyText(msg.message, slot->message, sizeof(slot->message));
+            diag_.end();
+        }
+        if (config_.dumpOnError && msg.level == DiagnosticValue::ERROR) {
+            requestDump();
+        }
+    }
+
+    /**
+     * @brief Asks the writer to copy the last dumpSeconds of data into a dump file.
+     *
+     * Requests within dumpSeconds of the previous dump are ignored so an error
+     * storm produces one dump instead of many overlapping ones.
+     */
+    void requestDump() {
+        const uint64_t now = nowNs();
+        const uint64_t window = static_cast<uint64_t>(config_.dumpSeconds * 1e9);
+        const uint64_t last = lastDumpTime_.load(std::memory_order_relaxed);
+        if (last != 0 && now - last < window) {
+            return;
+        }
+        uint64_t expected = 0;
+        if (dumpRequest_.compare_exchange_strong(expected, now)) {
+            lastDumpTime_.store(now, std::memory_order_relaxed);
+        }
+    }
+
+    FlightRecorderStats stats() const {
+        FlightRecorderStats stats;
+        stats.records = written_.load(std::memory_order_relaxed);
+        stats.bytes = bytes_.load(std::memory_order_relaxed);
+        stats.dropped = state_.dropped() + cmd_.dropped() + imu_.dropped() + joy_.dropped() + diag_.dropped() +
+                        writeErrors_.load(std::memory_order_relaxed);
+        stats.segments = segmentCount_.load(std::memory_order_relaxed);
+        stats.dumps = dumpCount_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    /**
+     * @brief One recorded stream: an SPSC ring plus a try-lock that keeps it single-producer.
+     */
+    template <typename Capture, size_t Capacity>
+    class Channel {
+    public:
+        Channel() : contended_(0) { busy_.clear(); }
+
+        Capture* begin() {
+            if (busy_.test_and_set(std::memory_order_acquire)) {
+                contended_.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Capture* slot = ring_.reserve();
+            if (!slot) {
+                busy_.clear(std::memory_order_release);
+            }
+            return slot;
+        }
+
+        void end() {
+            ring_.commit();
+            busy_.clear(std::memory_order_release);
+        }
+
+        uint64_t frontTime() const {
+            const Capture* front = ring_.front();
+            return front ? front->time : UINT64_MAX;
+        }
+
+        const Capture* front() const { return ring_.front(); }
+        void pop() { ring_.pop(); }
+        uint64_t dropped() const { return ring_.dropped() + contended_.load(std::memory_order_relaxed); }
+
+    private:
+        SpscRing<Capture, Capacity> ring_;
+        std::atomic_flag busy_;
+        std::atomic<uint64_t> contended_;
+    };
+
+    enum { STREAM_COUNT = 5 };
+
+    // Records newer than this stay in the rings for one more pass so that a
+    // producer preempted between stamping and committing is still merged in order
+    static const uint64_t HOLDBACK_NS = 2000000;
+
+    static uint64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    static uint32_t clampCount(size_t count, uint32_t max) {
+        return static_cast<uint32_t>(std::min<size_t>(count, max));
+    }
+
+    template <typename Vector, typename T>
+    static void copyN(const Vector& src, T* dst, uint32_t count) {
+        const size_t n = std::min<size_t>(src.size(), count);
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = static_cast<T>(src[i]);
+        }
+        for (size_t i = n; i < count; ++i) {
+            dst[i] = T();
+        }
+    }
+
+    static void copyText(const std::string& src, char* dst, size_t size) {
+        const size_t n = std::min(src.size(), size - 1);
+        std::memcpy(dst, src.data(), n);
+        dst[n] = '\0';
+    }
+
+    static bool makeDirectories(const std::string& path) {
+#ifdef _WIN32
+        return false;
+#else
+        for (size_t pos = 1; pos <= path.size(); ++pos) {
+            if (pos == path.size() || path[pos] == '/') {
+                std::string partial = path.substr(0, pos);
+                if (mkdir(partial.c_str(), 0755) != 0 && errno != EEXIST) {
+                    return false;
+                }
+            }
+        }
+        return true;
+#endif
+    }
+
+    void writerLoop() {
+#ifndef _WIN32
+        // Stay out of the way of the control threads
+        setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+        for (;;) {
+            const bool stopping = !running_;
+            const uint64_t watermark = stopping ? UINT64_MAX : nowNs() - HOLDBACK_NS;
+            const size_t count = drain(watermark);
+
+            const uint64_t dumpTime = dumpRequest_.load(std::memory_order_acquire);
+            if (dumpTime != 0 && dumpTime <= watermark) {
+                writeDump(dumpTime);
+                dumpRequest_.store(0, std::memory_order_release);
+            }
+
+            if (stopping) {
+                break;
+            }
+            if (count == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        closeSegment();
+    }
+
+    /**
+     * @brief Writes ring contents up to @p watermark, merging the streams by capture time.
+     */
+    size_t drain(uint64_t watermark) {
+        size_t count = 0;
+        for (;;) {
+            uint64_t times[STREAM_COUNT] = {
+                state_.frontTime(), cmd_.frontTime(), imu_.frontTime(), joy_.frontTime(), diag_.frontTime()
+            };
+            int next = static_cast<int>(std::min_element(times, times + STREAM_COUNT) - times);
+            if (times[next] == UINT64_MAX || times[next] > watermark) {
+                return count;
+            }
+            switch (next) {
+                case 0: append(*state_.front()); state_.pop(); break;
+                case 1: append(*cmd_.front()); cmd_.pop(); break;
+                case 2: append(*imu_.front()); imu_.pop(); break;
+                case 3: append(*joy_.front()); joy_.pop(); break;
+                default: append(*diag_.front()); diag_.pop(); break;
+            }
+            ++count;
+        }
+    }
+
+    template <typename Capture>
+    void append(const Capture& capture) {
+        const uint32_t size = flight_log::encodedSize(capture);
+        if (segmentHeader_ && segmentHeader_->used + size > segmentHeader_->capacity) {
+            closeSegment();
+            openSegment();
+        }
+        if (!segmentHeader_ || segmentHeader_->used + size > segmentHeader_->capacity) {
+            writeErrors_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        uint8_t* dst = segmentBase_ + FlightSegmentHeader::HEADER_SIZE + segmentHeader_->used;
+        flight_log::encode(capture, dst);
+        if (segmentHeader_->record_count++ == 0) {
+            segmentHeader_->first_time = capture.time;
+        }
+        segmentHeader_->last_time = std::max(segmentHeader_->last_time, capture.time);
+        // Publish the record to concurrent readers of the segment
+#ifndef _WIN32
+        __atomic_store_n(&segmentHeader_->used, segmentHeader_->used + size, __ATOMIC_RELEASE);
+#endif
+        written_.fetch_add(1, std::memory_order_relaxed);
+        bytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    std::string segmentPath(uint64_t index) const {
+        char name[32];
+        std::snprintf(name, sizeof(name), "flight_%06llu.seg", static_cast<unsigned long long>(index));
+        return sessionDir_ + "/" + name;
+    }
+
+    bool openSegment() {
+#ifdef _WIN32
+        return false;
+#else
+        const std::string path = segmentPath(segmentIndex_);
+        const size_t fileSize = config_.segmentSizeMb * 1024 * 1024;
+        int fd = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd < 0) {
+            std::cerr << "Failed to create flight log segment: " << path << std::endl;
+            return false;
+        }
+        // Reserve the blocks up front so appends never wait on the allocator
+        if (posix_fallocate(fd, 0, fileSize) != 0 && ftruncate(fd, fileSize) != 0) {
+            std::cerr << "Failed to allocate flight log segment: " << path << std::endl;
+            ::close(fd);
+            return false;
+        }
+        int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+        flags |= MAP_POPULATE;
+#endif
+        void* addr = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, flags, fd, 0);
+        if (addr == MAP_FAILED) {
+            std::cerr << "Failed to map flight log segment: " << path << std::endl;
+            ::close(fd);
+            return false;
+        }
+
+        segmentFd_ = fd;
+        segmentBase_ = static_cast<uint8_t*>(addr);
+        segmentHeader_ = reinterpret_cast<FlightSegmentHeader*>(segmentBase_);
+        std::memset(segmentHeader_, 0, FlightSegmentHeader::HEADER_SIZE);
+        segmentHeader_->magic = FlightSegmentHeader::MAGIC;
+        segmentHeader_->version = FlightSegmentHeader::VERSION;
+        segmentHeader_->segment_index = segmentIndex_;
+        segmentHeader_->capacity = fileSize - FlightSegmentHeader::HEADER_SIZE;
+        segmentHeader_->wall_time_offset = wallTimeOffset_;
+
+        segments_.push_back(path);
+        while (segments_.size() > config_.maxSegments) {
+            unlink(segments_.front().c_str());
+            segments_.pop_front();
+        }
+        segmentIndex_++;
+        segmentCount_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+#endif
+    }
+
+    void closeSegment() {
+#ifndef _WIN32
+        if (!segmentBase_) {
+            return;
+        }
+        const size_t mapped = segmentHeader_->capacity + FlightSegmentHeader::HEADER_SIZE;
+        const off_t end = static_cast<off_t>(FlightSegmentHeader::HEADER_SIZE + segmentHeader_->used);
+        munmap(segmentBase_, mapped);
+        // Give back the unused preallocation
+        if (ftruncate(segmentFd_, end) != 0) {
+            std::cerr << "Failed to trim flight log segment" << std::endl;
+        }
+        ::close(segmentFd_);
+        segmentFd_ = -1;
+        segmentBase_ = nullptr;
+        segmentHeader_ = nullptr;
+#endif
+    }
+
+    /**
+     * @brief Copies records from [trigger - dumpSeconds, now] out of the retained segments.
+     */
+    void writeDump(uint64_t trigger) {
+        const uint64_t window = static_cast<uint64_t>(config_.dumpSeconds * 1e9);
+        const uint64_t cutoff = trigger > window ? trigger - window : 0;
+
+        char name[32];
+        std::snprintf(name, sizeof(name), "dump_%03llu.seg",
+                      static_cast<unsigned long long>(dumpCount_.load(std::memory_order_relaxed)));
+        const std::string path = sessionDir_ + "/" + name;
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            std::cerr << "Failed to create flight log dump: " << path << std::endl;
+            return;
+        }
+
+        FlightSegmentHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = FlightSegmentHeader::MAGIC;
+        header.version = FlightSegmentHeader::VERSION;
+        header.wall_time_offset = wallTimeOffset_;
+        std::vector<char> padding(FlightSegmentHeader::HEADER_SIZE, 0);
+        out.write(padding.data(), padding.size());
+
+        // Segments are time ordered, so start from the newest one that still begins before the cutoff
+        size_t first = segments_.size();
+        while (first > 0) {
+            --first;
+            FlightSegmentReader reader;
+            if (reader.open(segments_[first]) && reader.header().first_time != 0 &&
+                reader.header().first_time <= cutoff) {
+                break;
+            }
+        }
+
+        for (size_t i = first; i < segments_.size(); ++i) {
+            FlightSegmentReader reader;
+            if (!reader.open(segments_[i])) {
+                continue;
+            }
+            FlightRecordView record;
+            while (reader.next(record)) {
+                if (record.time() < cutoff) {
+                    continue;
+                }
+                out.write(reinterpret_cast<const char*>(record.header), record.header->size);
+                if (header.record_count++ == 0) {
+                    header.first_time = record.time();
+                }
+                header.last_time = record.time();
+                header.used += record.header->size;
+            }
+        }
+
+        header.capacity = header.used;
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.close();
+        dumpCount_.fetch_add(1, std::memory_order_relaxed);
+        std::cout << "Flight recorder dumped " << header.record_count << " records to " << path << std::endl;
+    }
+
+    FlightRecorderConfig config_;
+    std::string sessionDir_;
+    std::atomic<bool> recording_;
+    std::atomic<bool> running_;
+    std::atomic<uint64_t> dumpRequest_;     // Trigger time of a pending dump, 0 if none
+    std::atomic<uint64_t> lastDumpTime_;
+    std::thread writerThread_;
+
+    // Ring sizes cover several hundred milliseconds of a 1 kHz stream
+    Channel<RobotStateCapture, 1024> state_;
+    Channel<RobotCmdCapture, 1024> cmd_;
+    Channel<ImuCapture, 2048> imu_;
+    Channel<SensorJoyCapture, 256> joy_;
+    Channel<DiagnosticCapture, 256> diag_;
+
+    std::atomic<uint64_t> written_;
+    std::atomic<uint64_t> bytes_;
+    std::atomic<uint64_t> writeErrors_;
+    std::atomic<uint64_t> segmentCount_;
+    std::atomic<uint64_t> dumpCount_;
+
+    // Writer thread state
+    int64_t wallTimeOffset_;
+    uint64_t segmentIndex_;
+    int segmentFd_;
+    uint8_t* segmentBase_;
+    FlightSegmentHeader* segmentHeader_;
+    std::deque<std::string> segments_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // FLIGHT_RECORDER_H
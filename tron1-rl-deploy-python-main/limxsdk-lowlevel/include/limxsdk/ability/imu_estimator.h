@@ -0,0 +1,179 @@
+/**
+ * @file imu_estimator.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef IMU_ESTIMATOR_H
+#define IMU_ESTIMATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/ability/seqlock.h"
+
+namespace limxsdk {
+namespace ability {
+
+struct LIMX_SDK_API ImuEstimatorConfig {
+    bool enabled = true;
+    float kp = 1.0f;                // Proportional gain on the accelerometer tilt error, rad/s
+    float ki = 0.05f;               // Integral gain driving the gyro bias estimate, rad/s^2
+    float accTolerance = 0.15f;     // Accelerometer ignored when |acc| is off g by more than this fraction
+    float maxBias = 0.1f;           // Limit of each gyro bias component, rad/s
+    float maxGap = 0.1f;            // Longer gaps between samples restart the filter, s
+};
+
+/**
+ * @struct ImuEstimate
+ * @brief Filtered IMU state as of one sample; quaternions are (w, x, y, z).
+ */
+struct LIMX_SDK_API ImuEstimate {
+    uint64_t stamp;                 // Stamp of the IMU sample, 0 before the first one
+    uint64_t samples;               // Samples filtered since start
+    float quat[4];                  // Orientation of the IMU in the world frame
+    float projectedGravity[3];      // R(quat)^T * (0, 0, -1)
+    float gyro[3];                  // Angular velocity with the bias removed, rad/s
+    float gyroBias[3];              // Current gyro bias estimate, rad/s
+    float acc[3];                   // Accelerometer reading of the sample, m/s^2
+    uint8_t accUsed;                // Whether the accelerometer corrected this sample
+};
+
+/**
+ * @class ImuEstimator
+ * @brief Mahony complementary filter run on every IMU sample.
+ *
+ * The gyro is integrated at the sample rate and the accelerometer pulls the
+ * tilt back with a PI correction, whose integral term is the gyro bias
+ * estimate. Samples taken under strong acceleration (|acc| far from g) skip
+ * the correction. Yaw is not observable from the accelerometer; it follows
+ * the bias-corrected gyro from the initial heading, which is taken from the
+ * device quaternion when it is valid. update() must be called from a single
+ * thread and takes constant time; load() may be called from any thread and
+ * never blocks the writer.
+ */
+class LIMX_SDK_API ImuEstimator {
+public:
+    explicit ImuEstimator(const ImuEstimatorConfig& config = ImuEstimatorConfig()) : config_(config) {}
+
+    const ImuEstimatorConfig& config() const { return config_; }
+
+    /**
+     * @brief Filters one sample and publishes the result.
+     */
+    void update(const ImuData& imu) {
+        const double dt = static_cast<double>(imu.stamp - stamp_) * 1e-9;
+        const bool restart = samples_ == 0 || imu.stamp <= stamp_ || dt > config_.maxGap;
+        stamp_ = imu.stamp;
+        samples_++;
+
+        bool accUsed = false;
+        float omega[3];
+        for (int i = 0; i < 3; ++i) {
+            omega[i] = imu.gyro[i] - bias_[i];
+        }
+        if (restart) {
+            seed(imu);
+        } else {
+            float correction[3] = {0.0f, 0.0f, 0.0f};
+            const float norm = std::sqrt(imu.acc[0] * imu.acc[0] + imu.acc[1] * imu.acc[1] + imu.acc[2] * imu.acc[2]);
+            if (std::fabs(norm - GRAVITY) < config_.accTolerance * GRAVITY) {
+                // Error between the measured and the estimated up direction in the body frame
+                float up[3];
+                upDirection(up);
+                const float a[3] = {imu.acc[0] / norm, imu.acc[1] / norm, imu.acc[2] / norm};
+                const float error[3] = {a[1] * up[2] - a[2] * up[1], a[2] * up[0] - a[0] * up[2],
+                                        a[0] * up[1] - a[1] * up[0]};
+                for (int i = 0; i < 3; ++i) {
+                    bias_[i] -= config_.ki * error[i] * static_cast<float>(dt);
+                    bias_[i] = std::max(-config_.maxBias, std::min(config_.maxBias, bias_[i]));
+                    correction[i] = config_.kp * error[i];
+                }
+                accUsed = true;
+            }
+            integrate(omega[0] + correction[0], omega[1] + correction[1], omega[2] + correction[2],
+                      static_cast<float>(dt));
+        }
+
+        ImuEstimate estimate;
+        estimate.stamp = imu.stamp;
+        estimate.samples = samples_;
+        float up[3];
+        upDirection(up);
+        for (int i = 0; i < 4; ++i) {
+            estimate.quat[i] = q_[i];
+        }
+        for (int i = 0; i < 3; ++i) {
+            estimate.projectedGravity[i] = -up[i];
+            estimate.gyro[i] = omega[i];
+            estimate.gyroBias[i] = bias_[i];
+            estimate.acc[i] = imu.acc[i];
+        }
+        estimate.accUsed = accUsed ? 1 : 0;
+        published_.store(estimate);
+    }
+
+    /**
+     * @brief Latest estimate; samples is 0 until the first update().
+     */
+    ImuEstimate load() const { return published_.load(); }
+
+private:
+    static constexpr float GRAVITY = 9.81f;
+
+    // Starts from the device quaternion if it is a unit quaternion, else levels on the accelerometer
+    void seed(const ImuData& imu) {
+        const float norm = std::sqrt(imu.quat[0] * imu.quat[0] + imu.quat[1] * imu.quat[1] +
+                                     imu.quat[2] * imu.quat[2] + imu.quat[3] * imu.quat[3]);
+        if (std::fabs(norm - 1.0f) < 0.01f) {
+            for (int i = 0; i < 4; ++i) {
+                q_[i] = imu.quat[i] / norm;
+            }
+            return;
+        }
+        const float roll = std::atan2(imu.acc[1], imu.acc[2]);
+        const float pitch = std::atan2(-imu.acc[0], std::sqrt(imu.acc[1] * imu.acc[1] + imu.acc[2] * imu.acc[2]));
+        const float cr = std::cos(0.5f * roll), sr = std::sin(0.5f * roll);
+        const float cp = std::cos(0.5f * pitch), sp = std::sin(0.5f * pitch);
+        q_[0] = cr * cp;
+        q_[1] = sr * cp;
+        q_[2] = cr * sp;
+        q_[3] = -sr * sp;
+    }
+
+    // World up (0, 0, 1) expressed in the body frame, R(q)^T * e_z
+    void upDirection(float up[3]) const {
+        const float w = q_[0], x = q_[1], y = q_[2], z = q_[3];
+        up[0] = 2.0f * (x * z - w * y);
+        up[1] = 2.0f * (y * z + w * x);
+        up[2] = w * w - x * x - y * y + z * z;
+    }
+
+    // q += 0.5 * q * (0, omega) * dt, then renormalized
+    void integrate(float gx, float gy, float gz, float dt) {
+        const float h = 0.5f * dt;
+        const float w = q_[0], x = q_[1], y = q_[2], z = q_[3];
+        q_[0] = w + h * (-x * gx - y * gy - z * gz);
+        q_[1] = x + h * (w * gx + y * gz - z * gy);
+        q_[2] = y + h * (w * gy - x * gz + z * gx);
+        q_[3] = z + h * (w * gz + x * gy - y * gx);
+        const float inv = 1.0f / std::sqrt(q_[0] * q_[0] + q_[1] * q_[1] + q_[2] * q_[2] + q_[3] * q_[3]);
+        for (int i = 0; i < 4; ++i) {
+            q_[i] *= inv;
+        }
+    }
+
+    ImuEstimatorConfig config_;
+    float q_[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+    float bias_[3] = {0.0f, 0.0f, 0.0f};
+    uint64_t stamp_ = 0;
+    uint64_t samples_ = 0;
+    SeqLock<ImuEstimate> published_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // IMU_ESTIMATOR_H
@@ -0,0 +1,131 @@
+/**
+ * @file imu_preintegrator.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef IMU_PREINTEGRATOR_H
+#define IMU_PREINTEGRATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/ability/seqlock.h"
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @struct ImuWindow
+ * @brief Mean IMU rates over the samples of the last window.
+ */
+struct LIMX_SDK_API ImuWindow {
+    uint64_t stamp;         // Stamp of the newest sample, 0 before the first one
+    uint32_t samples;       // Samples in the window
+    float gyro[3];
+    float acc[3];
+};
+
+/**
+ * @class ImuPreintegrator
+ * @brief Sliding mean of gyro and acc over the last policy period, fed with every IMU sample.
+ *
+ * A policy that runs every decimation-th control tick only sees the IMU at
+ * its step boundary. Averaging all samples since the previous step instead
+ * is a boxcar filter one policy period long, whose nulls fall on the policy
+ * rate and its harmonics, so vibration there no longer aliases into the
+ * observation. Samples live in a fixed ring with running sums: push() adds
+ * the new sample and drops those older than the window, in amortized O(1).
+ * push() must be called from one thread; load() may be called from any.
+ */
+class LIMX_SDK_API ImuPreintegrator {
+public:
+    static const size_t CAPACITY = 128;     // Samples kept at most, whatever the window
+
+    /**
+     * @brief Window length in seconds; may be changed from any thread and applies from the next push().
+     */
+    void setWindow(double seconds) {
+        windowNs_.store(seconds > 0.0 ? static_cast<uint64_t>(seconds * 1e9) : 1, std::memory_order_relaxed);
+    }
+
+    void push(const ImuData& imu) {
+        if (count_ > 0 && imu.stamp < ring_[newest()].stamp) {
+            // Time went backwards, e.g. a looping replay; start over
+            clear();
+        }
+        if (count_ == CAPACITY) {
+            evict();
+        }
+        Sample& s = ring_[(head_ + count_) % CAPACITY];
+        s.stamp = imu.stamp;
+        for (int i = 0; i < 3; ++i) {
+            s.gyro[i] = imu.gyro[i];
+            s.acc[i] = imu.acc[i];
+            gyroSum_[i] += s.gyro[i];
+            accSum_[i] += s.acc[i];
+        }
+        count_++;
+        const uint64_t windowNs = windowNs_.load(std::memory_order_relaxed);
+        while (count_ > 1 && imu.stamp - ring_[head_].stamp >= windowNs) {
+            evict();
+        }
+
+        ImuWindow window;
+        window.stamp = imu.stamp;
+        window.samples = static_cast<uint32_t>(count_);
+        for (int i = 0; i < 3; ++i) {
+            window.gyro[i] = static_cast<float>(gyroSum_[i] / count_);
+            window.acc[i] = static_cast<float>(accSum_[i] / count_);
+        }
+        published_.store(window);
+    }
+
+    /**
+     * @brief Mean over the current window; samples is 0 until the first push().
+     */
+    ImuWindow load() const { return published_.load(); }
+
+private:
+    struct Sample {
+        uint64_t stamp;
+        float gyro[3];
+        float acc[3];
+    };
+
+    size_t newest() const { return (head_ + count_ - 1) % CAPACITY; }
+
+    void evict() {
+        const Sample& s = ring_[head_];
+        for (int i = 0; i < 3; ++i) {
+            gyroSum_[i] -= s.gyro[i];
+            accSum_[i] -= s.acc[i];
+        }
+        head_ = (head_ + 1) % CAPACITY;
+        count_--;
+    }
+
+    void clear() {
+        head_ = 0;
+        count_ = 0;
+        for (int i = 0; i < 3; ++i) {
+            gyroSum_[i] = 0.0;
+            accSum_[i] = 0.0;
+        }
+    }
+
+    std::atomic<uint64_t> windowNs_{20000000};  // One policy step at 50 Hz
+    Sample ring_[CAPACITY];
+    size_t head_ = 0;                       // Oldest sample
+    size_t count_ = 0;
+    double gyroSum_[3] = {0.0, 0.0, 0.0};   // Double sums keep add/subtract drift negligible
+    double accSum_[3] = {0.0, 0.0, 0.0};
+    SeqLock<ImuWindow> published_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // IMU_PREINTEGRATOR_H
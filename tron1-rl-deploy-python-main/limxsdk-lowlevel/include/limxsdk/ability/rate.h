@@ -6,13 +6,138 @@
 
 #ifndef RATE_H
 #define RATE_H
+#include <atomic>
 #include <chrono>
+#include <climits>
+#include <cstdint>
 #include <thread>
 #include "limxsdk/macros.h"
 
 namespace limxsdk {
 namespace ability {
 
+/**
+ * @struct LoopStats
+ * @brief Cycle statistics of a rate-controlled loop.
+ *
+ * Every Rate::sleep() on a thread records into the LoopStats bound to that
+ * thread via LoopStats::current(). BaseAbility binds its own statistics to the
+ * ability thread, so ability loops are measured without any code changes.
+ */
+struct LIMX_SDK_API LoopStats {
+  LoopStats() { reset(); }
+
+  void reset() {
+    cycles.store(0, std::memory_order_relaxed);
+    overruns.store(0, std::memory_order_relaxed);
+    last_cycle_ns.store(0, std::memory_order_relaxed);
+    max_cycle_ns.store(0, std::memory_order_relaxed);
+    expected_cycle_ns.store(0, std::memory_order_relaxed);
+  }
+
+  void record(int64_t cycle_ns, int64_t expected_ns, bool overrun) {
+    cycles.fetch_add(1, std::memory_order_relaxed);
+    if (overrun) {
+      overruns.fetch_add(1, std::memory_order_relaxed);
+    }
+    last_cycle_ns.store(cycle_ns, std::memory_order_relaxed);
+    expected_cycle_ns.store(expected_ns, std::memory_order_relaxed);
+    if (cycle_ns > max_cycle_ns.load(std::memory_order_relaxed)) {
+      max_cycle_ns.store(cycle_ns, std::memory_order_relaxed);
+    }
+  }
+
+  // Statistics slot of the calling thread, nullptr when nothing is bound.
+  static LoopStats*& current() {
+    static thread_local LoopStats* stats = nullptr;
+    return stats;
+  }
+
+  std::atomic<uint64_t> cycles;            ///< Number of completed cycles
+  std::atomic<uint64_t> overruns;          ///< Cycles that exceeded the expected cycle time
+  std::atomic<int64_t> last_cycle_ns;      ///< Time from the scheduled cycle start to sleep() (work plus wake-up latency)
+  std::atomic<int64_t> max_cycle_ns;       ///< Largest last_cycle_ns since reset
+  std::atomic<int64_t> expected_cycle_ns;  ///< Configured cycle time
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Distribution of measured durations with 1 us resolution up to BUCKETS us.
+ *
+ * Recording is a few integer operations and never allocates, so it can be
+ * used for every cycle of a control loop. Not thread safe: record and read
+ * from the same thread, or copy the histogram under the caller's lock.
+ */
+class LIMX_SDK_API LatencyHistogram {
+public:
+  enum { BUCKETS = 2000 };
+
+  LatencyHistogram() { reset(); }
+
+  void reset() {
+    for (auto& bucket : buckets_) {
+      bucket = 0;
+    }
+    count_ = 0;
+    overflow_ = 0;
+    sum_ns_ = 0;
+    min_ns_ = INT64_MAX;
+    max_ns_ = 0;
+  }
+
+  void record(int64_t ns) {
+    if (ns < 0) {
+      ns = 0;
+    }
+    const int64_t us = ns / 1000;
+    if (us < BUCKETS) {
+      buckets_[us]++;
+    } else {
+      overflow_++;
+    }
+    count_++;
+    sum_ns_ += ns;
+    if (ns < min_ns_) {
+      min_ns_ = ns;
+    }
+    if (ns > max_ns_) {
+      max_ns_ = ns;
+    }
+  }
+
+  uint64_t count() const { return count_; }
+  uint64_t overflow() const { return overflow_; }
+  int64_t min_ns() const { return count_ ? min_ns_ : 0; }
+  int64_t max_ns() const { return max_ns_; }
+  double mean_ns() const { return count_ ? static_cast<double>(sum_ns_) / count_ : 0.0; }
+
+  /**
+   * @brief Upper bound of the bucket holding quantile @p q (0..1); max_ns() if it lies in the overflow.
+   */
+  int64_t percentile_ns(double q) const {
+    if (count_ == 0) {
+      return 0;
+    }
+    const uint64_t rank = static_cast<uint64_t>(q * (count_ - 1)) + 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+      seen += buckets_[i];
+      if (seen >= rank) {
+        return (static_cast<int64_t>(i) + 1) * 1000;
+      }
+    }
+    return max_ns_;
+  }
+
+private:
+  uint64_t buckets_[BUCKETS];
+  uint64_t count_;
+  uint64_t overflow_;
+  int64_t sum_ns_;
+  int64_t min_ns_;
+  int64_t max_ns_;
+};
+
 /**
  * @class Rate
  * @brief A utility class for controlling a loop rate in real-time applications.
@@ -44,6 +169,14 @@ public:
 
     // Calculate actual cycle time
     actual_cycle_time_ = current_time - start_time_;
+
+    // Record into the statistics bound to this thread, if any
+    LoopStats* stats = LoopStats::current();
+    if (stats) {
+      stats->record(std::chrono::duration_cast<std::chrono::nanoseconds>(actual_cycle_time_).count(),
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(expected_cycle_time_).count(),
+                    current_time > expected_end_time);
+    }
     
     // Determine next start time
     start_time_ = expected_end_time;
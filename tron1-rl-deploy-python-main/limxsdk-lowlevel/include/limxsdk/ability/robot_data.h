@@ -18,19 +18,33 @@
 #include "limxsdk/pointfoot.h"
 #include "limxsdk/humanoid.h"
 #include "limxsdk/wheellegged.h"
+#include "limxsdk/replay.h"
+#include "limxsdk/loopback.h"
+#include "limxsdk/ability/flight_recorder.h"
+#include "limxsdk/ability/base_velocity_estimator.h"
+#include "limxsdk/ability/imu_estimator.h"
 
 namespace limxsdk {
 namespace ability {
 
 class LIMX_SDK_API RobotData {
 public:
-  RobotData(const std::string& robot_ip, const std::string& robot_type) {
+  RobotData(const std::string& robot_ip, const std::string& robot_type,
+            const ImuEstimatorConfig& imu_estimator = ImuEstimatorConfig(),
+            const BaseVelocityEstimatorConfig& base_velocity = BaseVelocityEstimatorConfig())
+    : baseVelocityEstimator(base_velocity), imuEstimator(imu_estimator) {
     if (robot_type == "PointFoot") {
         robot = limxsdk::PointFoot::getInstance();
     } else if (robot_type == "Humanoid") {
         robot = limxsdk::Humanoid::getInstance();
     } else if (robot_type == "Wheellegged") {
         robot = limxsdk::Wheellegged::getInstance();
+    } else if (robot_type == "Replay") {
+        // robot_ip is the recording to play back
+        robot = limxsdk::Replay::getInstance();
+    } else if (robot_type == "Loopback") {
+        // robot_ip selects the simulated joints, see Loopback::init()
+        robot = limxsdk::Loopback::getInstance();
     } else {
         std::cerr<< "Unsupported robot type: " << robot_type << std::endl;
         abort();
@@ -45,12 +59,19 @@ public:
       imuDataMutex.lock();
       imuData = *msg;
       imuDataMutex.unlock();
+      // Filtered on the SDK thread at the full IMU rate
+      if (imuEstimator.config().enabled) {
+        imuEstimator.update(*msg);
+      }
     });
 
     robot->subscribeRobotState([this](const limxsdk::RobotStateConstPtr& msg){
       robotStateMutex.lock();
       robotState = *msg;
       robotStateMutex.unlock();
+      if (baseVelocityEstimator.config().enabled) {
+        baseVelocityEstimator.update(*msg, imuEstimator.load());
+      }
     });
   }
 
@@ -59,6 +80,20 @@ public:
       return imuData;
   }
 
+  /**
+   * Latest filtered orientation, gravity and gyro; lock-free. samples is 0 while the estimator is disabled or idle.
+   */
+  ImuEstimate get_imu_estimate() const {
+    return imuEstimator.load();
+  }
+
+  /**
+   * Latest base linear velocity; lock-free. updates is 0 while the estimator is disabled or has no IMU estimate.
+   */
+  BaseVelocityEstimate get_base_velocity() const {
+    return baseVelocityEstimator.load();
+  }
+
   limxsdk::RobotState get_robot_state() { 
     std::lock_guard<std::mutex> lock(robotStateMutex);
     return robotState;
@@ -68,12 +103,46 @@ public:
     return robot;
   }
 
+  /**
+   * Publishes a command to the robot; commands are also captured by the flight recorder when it runs.
+   */
+  bool publish_robot_cmd(const limxsdk::RobotCmd& cmd) {
+    if (recorder) {
+      recorder->recordRobotCmd(cmd);
+    }
+    return robot->publishRobotCmd(cmd);
+  }
+
+  /**
+   * Starts recording all robot streams. Can only be started once per process
+   * because SDK subscriptions cannot be removed.
+   */
+  bool start_flight_recorder(const FlightRecorderConfig& config) {
+    if (recorder) {
+      return recorder->isRecording();
+    }
+    recorder = std::unique_ptr<FlightRecorder>(new FlightRecorder());
+    if (!recorder->start(config)) {
+      recorder.reset();
+      return false;
+    }
+    recorder->attach(robot);
+    return true;
+  }
+
+  FlightRecorder* get_flight_recorder() const {
+    return recorder.get();
+  }
+
 private:
   limxsdk::ApiBase* robot;  // Robot instance
   limxsdk::RobotState robotState;     // Shared robot state
   std::mutex robotStateMutex;
+  BaseVelocityEstimator baseVelocityEstimator;  // Fed by the robot state subscription
   limxsdk::ImuData imuData;           // Shared IMU data
   std::mutex imuDataMutex;
+  ImuEstimator imuEstimator;          // Fed by the IMU subscription
+  std::unique_ptr<FlightRecorder> recorder;  // Optional flight recorder
 };
 
 } // namespace ability
@@ -0,0 +1,80 @@
+/**
+ * @file seqlock.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @class SeqLock
+ * @brief Single-writer, multi-reader sequence lock for trivially copyable data.
+ *
+ * The writer never blocks and readers never write, so a SeqLock can also be
+ * placed in a read-only shared memory mapping on the reader side. Readers
+ * retry while a write is in progress.
+ */
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires a trivially copyable type");
+
+public:
+  SeqLock() : sequence_(0), value_() {}
+
+  /**
+   * @brief Publishes a new value. Must only be called from one thread.
+   */
+  void store(const T& value) {
+    uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&value_, &value, sizeof(T));
+    sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+  /**
+   * @brief Attempts a single consistent read.
+   * @return False if a write was in progress; @p out is then unspecified.
+   */
+  bool try_load(T& out) const {
+    uint32_t before = sequence_.load(std::memory_order_acquire);
+    if (before & 1u) {
+      return false;
+    }
+    std::memcpy(&out, &value_, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence_.load(std::memory_order_relaxed) == before;
+  }
+
+  /**
+   * @brief Reads a consistent value, spinning while a write is in progress.
+   */
+  T load() const {
+    T out;
+    while (!try_load(out)) {
+    }
+    return out;
+  }
+
+  /**
+   * @brief Number of completed writes.
+   */
+  uint32_t version() const { return sequence_.load(std::memory_order_acquire) >> 1; }
+
+private:
+  std::atomic<uint32_t> sequence_;
+  T value_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+#endif // SEQLOCK_H
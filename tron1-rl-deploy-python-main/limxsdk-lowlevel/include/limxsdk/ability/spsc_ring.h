@@ -0,0 +1,119 @@
+/**
+ * @file spsc_ring.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @class SpscRing
+ * @brief Bounded wait-free single-producer/single-consumer ring buffer.
+ *
+ * Storage is embedded, so construction is the only allocation. push() never
+ * blocks: when the ring is full the element is dropped and counted.
+ *
+ * @tparam T Element type, copied by value.
+ * @tparam Capacity Number of slots, must be a power of two.
+ */
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  SpscRing() : head_(0), tail_(0), dropped_(0) {}
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  /**
+   * @brief Producer side. Returns false (and counts a drop) if the ring is full.
+   */
+  bool push(const T& value) {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= Capacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    slots_[head & (Capacity - 1)] = value;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Producer side. Gives direct access to the next free slot, or nullptr if full.
+   *        The slot becomes visible to the consumer on commit().
+   */
+  T* reserve() {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) >= Capacity) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &slots_[head & (Capacity - 1)];
+  }
+
+  void commit() {
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * @brief Consumer side. Returns the oldest element without removing it, or nullptr if empty.
+   */
+  const T* front() const {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &slots_[tail & (Capacity - 1)];
+  }
+
+  /**
+   * @brief Consumer side. Releases the element returned by front().
+   */
+  void pop() {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  bool pop(T& out) {
+    const T* value = front();
+    if (!value) {
+      return false;
+    }
+    out = *value;
+    pop();
+    return true;
+  }
+
+  size_t size() const {
+    return static_cast<size_t>(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire));
+  }
+
+  static constexpr size_t capacity() { return Capacity; }
+
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  // Producer and consumer indices are padded onto separate cache lines to avoid
+  // false sharing. Padding instead of alignas keeps heap allocation valid in C++11.
+  enum { CACHE_LINE = 64 };
+  std::atomic<uint64_t> head_;
+  char head_pad_[CACHE_LINE - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint64_t> tail_;
+  char tail_pad_[CACHE_LINE - sizeof(std::atomic<uint64_t>)];
+  std::atomic<uint64_t> dropped_;
+  char dropped_pad_[CACHE_LINE - sizeof(std::atomic<uint64_t>)];
+  T slots_[Capacity];
+};
+
+} // namespace ability
+} // namespace limxsdk
+#endif // SPSC_RING_H
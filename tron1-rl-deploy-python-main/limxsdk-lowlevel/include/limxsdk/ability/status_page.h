@@ -0,0 +1,209 @@
+/**
+ * @file status_page.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef STATUS_PAGE_H
+#define STATUS_PAGE_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <iostream>
+#include <new>
+#include "limxsdk/macros.h"
+#include "limxsdk/ability/seqlock.h"
+
+#ifndef _WIN32
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace limxsdk {
+namespace ability {
+
+/**
+ * @brief Status of a single ability as published on the status page.
+ */
+struct LIMX_SDK_API StatusPageAbility {
+    char name[64];              // Ability name (null-terminated, truncated)
+    char type[64];              // Ability class name (null-terminated, truncated)
+    uint32_t running;           // 1 while the ability thread is active
+    uint32_t reserved;
+    uint64_t start_count;       // Number of times the ability was started
+    uint64_t cycles;            // Rate::sleep() cycles since the last start
+    uint64_t overruns;          // Cycles that missed their deadline
+    int64_t last_cycle_ns;      // Scheduled start to sleep() of the last cycle
+    int64_t max_cycle_ns;       // Largest last_cycle_ns since the last start
+    int64_t expected_cycle_ns;  // Configured cycle time
+};
+
+/**
+ * @brief Snapshot of all ability states, copied out of the page by readers.
+ */
+struct LIMX_SDK_API StatusPageData {
+    enum { MAX_ABILITIES = 32 };
+
+    uint64_t stamp;             // Publish time in nanoseconds (steady clock)
+    uint32_t pid;               // Process id of the ability manager
+    uint32_t ability_count;     // Valid entries in abilities[]
+    StatusPageAbility abilities[MAX_ABILITIES];
+};
+
+/**
+ * @brief Memory layout of the shared status page.
+ */
+struct LIMX_SDK_API StatusPageLayout {
+    enum : uint32_t { MAGIC = 0x4C4D5853, VERSION = 1 };  // "SXML"
+
+    uint32_t magic;
+    uint32_t version;
+    SeqLock<StatusPageData> data;
+};
+
+/**
+ * @class StatusPageWriter
+ * @brief Creates the POSIX shared-memory status page and publishes snapshots into it.
+ */
+class LIMX_SDK_API StatusPageWriter {
+public:
+    StatusPageWriter() : page_(nullptr) {}
+    ~StatusPageWriter() { close(); }
+
+    StatusPageWriter(const StatusPageWriter&) = delete;
+    StatusPageWriter& operator=(const StatusPageWriter&) = delete;
+
+    /**
+     * @brief Creates (or replaces) the shared memory object @p name, e.g. "/limx_ability_status".
+     * @return True on success.
+     */
+    bool open(const std::string& name) {
+#ifdef _WIN32
+        std::cerr << "Status page is not supported on this platform" << std::endl;
+        return false;
+#else
+        close();
+        int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+        if (fd < 0) {
+            std::cerr << "Failed to create status page: " << name << std::endl;
+            return false;
+        }
+        if (ftruncate(fd, sizeof(StatusPageLayout)) != 0) {
+            std::cerr << "Failed to size status page: " << name << std::endl;
+            ::close(fd);
+            return false;
+        }
+        void* addr = mmap(nullptr, sizeof(StatusPageLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            std::cerr << "Failed to map status page: " << name << std::endl;
+            return false;
+        }
+
+        page_ = new (addr) StatusPageLayout();
+        page_->magic = StatusPageLayout::MAGIC;
+        page_->version = StatusPageLayout::VERSION;
+        name_ = name;
+        std::cout << "Status page published at shm:" << name_ << std::endl;
+        return true;
+#endif
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (page_) {
+            page_->magic = 0;
+            munmap(page_, sizeof(StatusPageLayout));
+            shm_unlink(name_.c_str());
+            page_ = nullptr;
+        }
+#endif
+    }
+
+    bool isOpen() const { return page_ != nullptr; }
+
+    void publish(const StatusPageData& data) {
+        if (page_) {
+            page_->data.store(data);
+        }
+    }
+
+private:
+    StatusPageLayout* page_;
+    std::string name_;
+};
+
+/**
+ * @class StatusPageReader
+ * @brief Maps the status page read-only. Reading a snapshot performs no system calls.
+ */
+class LIMX_SDK_API StatusPageReader {
+public:
+    StatusPageReader() : page_(nullptr) {}
+    ~StatusPageReader() { close(); }
+
+    StatusPageReader(const StatusPageReader&) = delete;
+    StatusPageReader& operator=(const StatusPageReader&) = delete;
+
+    bool open(const std::string& name) {
+#ifdef _WIN32
+        return false;
+#else
+        close();
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            return false;
+        }
+        void* addr = mmap(nullptr, sizeof(StatusPageLayout), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        page_ = static_cast<const StatusPageLayout*>(addr);
+        if (page_->magic != StatusPageLayout::MAGIC || page_->version != StatusPageLayout::VERSION) {
+            close();
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (page_) {
+            munmap(const_cast<StatusPageLayout*>(page_), sizeof(StatusPageLayout));
+            page_ = nullptr;
+        }
+#endif
+    }
+
+    bool isOpen() const { return page_ != nullptr; }
+
+    /**
+     * @brief Copies the latest consistent snapshot.
+     * @return False if the page is not mapped or the writer has shut down.
+     */
+    bool read(StatusPageData& out) const {
+        if (!page_ || page_->magic != StatusPageLayout::MAGIC) {
+            return false;
+        }
+        out = page_->data.load();
+        return true;
+    }
+
+    /**
+     * @brief Number of snapshots published so far; cheap change detection for pollers.
+     */
+    uint32_t version() const { return page_ ? page_->data.version() : 0; }
+
+private:
+    const StatusPageLayout* page_;
+};
+
+} // namespace ability
+} // namespace limxsdk
+
+#endif // STATUS_PAGE_H
@@ -12,6 +12,9 @@
 #include <vector>
 #include <yaml-cpp/yaml.h>
 #include "limxsdk/macros.h"
+#include "limxsdk/ability/flight_recorder.h"
+#include "limxsdk/ability/base_velocity_estimator.h"
+#include "limxsdk/ability/imu_estimator.h"
 
 namespace limxsdk {
 namespace ability {
@@ -28,9 +31,41 @@ struct LIMX_SDK_API LibraryConfig {
     std::vector<AbilityConfig> abilities;
 };
 
+struct LIMX_SDK_API RemoteCliConfig {
+    bool tcpEnabled = true;
+    std::string tcpAddress = "0.0.0.0";  // Bind address; "127.0.0.1" keeps the CLI local
+    int tcpPort = 8888;
+    std::string unixSocket;              // AF_UNIX endpoint path, empty to disable
+};
+
+struct LIMX_SDK_API StatusPageConfig {
+    std::string name;                    // POSIX shared memory name, empty to disable
+    double rate = 10.0;                  // Publish frequency in Hz
+};
+
+struct LIMX_SDK_API ReplayConfig {
+    double speed = 1.0;                  // Playback speed, 0 for as fast as possible
+    bool loop = false;
+    bool lockstep = false;               // Wait for one RobotCmd after every RobotState
+};
+
+struct LIMX_SDK_API LoopbackConfig {
+    double rate = 1000.0;                // RobotState and ImuData frequency in Hz
+    int substeps = 4;                    // Plant steps per period
+    double speed = 1.0;                  // Simulation speed, 0 for as fast as possible
+    bool lockstep = false;               // Wait for one RobotCmd after every RobotState
+};
+
 struct LIMX_SDK_API SystemConfig {
     std::string robotIp;
     std::string robotType;
+    RemoteCliConfig remoteCli;
+    StatusPageConfig statusPage;
+    FlightRecorderConfig flightRecorder;  // Disabled while directory is empty
+    ReplayConfig replay;                 // Used when robot_type is "Replay"
+    LoopbackConfig loopback;             // Used when robot_type is "Loopback"
+    ImuEstimatorConfig imuEstimator;     // Shared IMU filter, see BaseAbility::get_imu_estimate()
+    BaseVelocityEstimatorConfig baseVelocity;  // See BaseAbility::get_base_velocity()
     std::vector<LibraryConfig> libraries;
 };
 
@@ -55,7 +90,136 @@ public:
             if (yamlConfig["robot_type"]) {
                 config.robotType = yamlConfig["robot_type"].as<std::string>();
             }
+
+            // Parse remote CLI endpoints
+            if (yamlConfig["remote_cli"]) {
+                const YAML::Node& cliNode = yamlConfig["remote_cli"];
+                if (cliNode["tcp_enabled"]) {
+                    config.remoteCli.tcpEnabled = cliNode["tcp_enabled"].as<bool>();
+                }
+                if (cliNode["tcp_address"]) {
+                    config.remoteCli.tcpAddress = cliNode["tcp_address"].as<std::string>();
+                }
+                if (cliNode["tcp_port"]) {
+                    config.remoteCli.tcpPort = cliNode["tcp_port"].as<int>();
+                }
+                if (cliNode["unix_socket"]) {
+                    config.remoteCli.unixSocket = cliNode["unix_socket"].as<std::string>();
+                }
+            }
+
+            // Parse shared memory status page
+            if (yamlConfig["status_page"]) {
+                const YAML::Node& pageNode = yamlConfig["status_page"];
+                if (pageNode["name"]) {
+                    config.statusPage.name = pageNode["name"].as<std::string>();
+                }
+                if (pageNode["rate"]) {
+                    config.statusPage.rate = pageNode["rate"].as<double>();
+                }
+            }
+
+
+            // Parse flight recorder
+            if (yamlConfig["flight_recorder"]) {
+                const YAML::Node& recorderNode = yamlConfig["flight_recorder"];
+                FlightRecorderConfig& recorder = config.flightRecorder;
+                if (recorderNode["directory"]) {
+                    recorder.directory = recorderNode["directory"].as<std::string>();
+                }
+                if (recorderNode["segment_size_mb"]) {
+                    recorder.segmentSizeMb = recorderNode["segment_size_mb"].as<size_t>();
+                }
+                if (recorderNode["max_segments"]) {
+                    recorder.maxSegments = recorderNode["max_segments"].as<size_t>();
+                }
+                if (recorderNode["dump_seconds"]) {
+                    recorder.dumpSeconds = recorderNode["dump_seconds"].as<double>();
+                }
+                if (recorderNode["dump_on_error"]) {
+                    recorder.dumpOnError = recorderNode["dump_on_error"].as<bool>();
+                }
+            }
+
+            // Parse log replay options
+            if (yamlConfig["replay"]) {
+                const YAML::Node& replayNode = yamlConfig["replay"];
+                if (replayNode["speed"]) {
+                    config.replay.speed = replayNode["speed"].as<double>();
+                }
+                if (replayNode["loop"]) {
+                    config.replay.loop = replayNode["loop"].as<bool>();
+                }
+                if (replayNode["lockstep"]) {
+                    config.replay.lockstep = replayNode["lockstep"].as<bool>();
+                }
+            }
+
+            // Parse loopback simulator options
+            if (yamlConfig["loopback"]) {
+                const YAML::Node& loopbackNode = yamlConfig["loopback"];
+                if (loopbackNode["rate"]) {
+                    config.loopback.rate = loopbackNode["rate"].as<double>();
+                }
+                if (loopbackNode["substeps"]) {
+                    config.loopback.substeps = loopbackNode["substeps"].as<int>();
+                }
+                if (loopbackNode["speed"]) {
+                    config.loopback.speed = loopbackNode["speed"].as<double>();
+                }
+                if (loopbackNode["lockstep"]) {
+                    config.loopback.lockstep = loopbackNode["lockstep"].as<bool>();
+                }
+            }
             
+            // Parse IMU estimator gains
+            if (yamlConfig["imu_estimator"]) {
+                const YAML::Node& imuNode = yamlConfig["imu_estimator"];
+                ImuEstimatorConfig& imu = config.imuEstimator;
+                if (imuNode["enabled"]) {
+                    imu.enabled = imuNode["enabled"].as<bool>();
+                }
+                if (imuNode["kp"]) {
+                    imu.kp = imuNode["kp"].as<float>();
+                }
+                if (imuNode["ki"]) {
+                    imu.ki = imuNode["ki"].as<float>();
+                }
+                if (imuNode["acc_tolerance"]) {
+                    imu.accTolerance = imuNode["acc_tolerance"].as<float>();
+                }
+                if (imuNode["max_bias"]) {
+                    imu.maxBias = imuNode["max_bias"].as<float>();
+                }
+                if (imuNode["max_gap"]) {
+                    imu.maxGap = imuNode["max_gap"].as<float>();
+                }
+            }
+
+            // Parse base velocity estimator; present means enabled
+            if (yamlConfig["base_velocity_estimator"]) {
+                const YAML::Node& velocityNode = yamlConfig["base_velocity_estimator"];
+                BaseVelocityEstimatorConfig& velocity = config.baseVelocity;
+                velocity.enabled = velocityNode["enabled"] ? velocityNode["enabled"].as<bool>() : true;
+                model::LegType legType = model::LegType::POINTFOOT;
+                if (velocityNode["leg_type"] &&
+                    !model::parseLegType(velocityNode["leg_type"].as<std::string>(), legType)) {
+                    std::cerr << "Error: leg_type must be PointFoot, SoleFoot or WheelFoot" << std::endl;
+                    abort();
+                }
+                velocity.geometry = model::LegGeometry::nominal(legType);
+                parseLegGeometry(velocityNode, velocity.geometry);
+                if (velocityNode["acc_noise"]) {
+                    velocity.accNoise = velocityNode["acc_noise"].as<float>();
+                }
+                if (velocityNode["contact_noise"]) {
+                    velocity.contactNoise = velocityNode["contact_noise"].as<float>();
+                }
+                if (velocityNode["contact_height"]) {
+                    velocity.contactHeight = velocityNode["contact_height"].as<float>();
+                }
+            }
+
             // Parse libraries
             if (yamlConfig["libraries"]) {
                 for (const auto& libraryNode : yamlConfig["libraries"]) {
@@ -108,6 +272,52 @@ public:
         
         return config;
     }
+
+    /**
+     * @brief Optional URDF values replacing the nominal leg in @p geometry.
+     *
+     * origins [[x, y, z], ...] per joint, contact, wheel_radius, and links
+     * [{mass, com: [x, y, z], inertia: [xx, yy, zz, xy, xz, yz]}, ...] per joint.
+     */
+    static void parseLegGeometry(const YAML::Node& node, model::LegGeometry& geometry) {
+        if (node["origins"]) {
+            const YAML::Node& origins = node["origins"];
+            if (origins.size() != static_cast<size_t>(geometry.joints)) {
+                std::cerr << "Error: origins needs one [x, y, z] per leg joint (" << geometry.joints << ")" << std::endl;
+                abort();
+            }
+            for (int i = 0; i < geometry.joints; ++i) {
+                for (int k = 0; k < 3; ++k) {
+                    geometry.origin[i][k] = origins[i][k].as<float>();
+                }
+            }
+        }
+        if (node["contact"]) {
+            for (int k = 0; k < 3; ++k) {
+                geometry.contact[k] = node["contact"][k].as<float>();
+            }
+        }
+        if (node["wheel_radius"]) {
+            geometry.wheelRadius = node["wheel_radius"].as<float>();
+        }
+        if (node["links"]) {
+            const YAML::Node& links = node["links"];
+            if (links.size() != static_cast<size_t>(geometry.joints)) {
+                std::cerr << "Error: links needs one entry per leg joint (" << geometry.joints << ")" << std::endl;
+                abort();
+            }
+            for (int i = 0; i < geometry.joints; ++i) {
+                model::LinkInertia& link = geometry.link[i];
+                link.mass = links[i]["mass"] ? links[i]["mass"].as<float>() : link.mass;
+                for (int k = 0; k < 3 && links[i]["com"]; ++k) {
+                    link.com[k] = links[i]["com"][k].as<float>();
+                }
+                for (int k = 0; k < 6 && links[i]["inertia"]; ++k) {
+                    link.inertia[k] = links[i]["inertia"][k].as<float>();
+                }
+            }
+        }
+    }
 };
 
 } // namespace ability
@@ -0,0 +1,527 @@
+/**
+ * @file loopback.h
+ *
+ * @brief This file contains the declarations of classes related to the in-process loopback simulator.
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef _LIMX_SDK_LOOPBACK_H_
+#define _LIMX_SDK_LOOPBACK_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/apibase.h"
+
+namespace limxsdk
+{
+  /**
+   * @brief Plant parameters of one simulated joint.
+   */
+  struct LoopbackJoint
+  {
+    std::string name;
+    float inertia = 0.05f;      // Link and reflected rotor inertia about the joint axis (kg m^2)
+    float damping = 0.1f;       // Viscous friction (Nm s/rad)
+    float friction = 0.0f;      // Coulomb friction (Nm)
+    float gravity = 0.0f;       // Largest gravity torque of the link, m g l (Nm)
+    float gravityZero = 0.0f;   // Angle at which the link hangs straight down (rad)
+    float torqueLimit = 80.0f;  // Actuator torque limit (Nm)
+    float lower = -std::numeric_limits<float>::infinity();  // Hard stops (rad)
+    float upper = std::numeric_limits<float>::infinity();
+    float initial = 0.0f;       // Angle at start (rad)
+  };
+
+  /**
+   * @brief Robot backend that simulates the joints in-process instead of talking to a robot.
+   *
+   * Every joint is an independent rigid link on a fixed base: its actuator
+   * applies the commanded Kp (q_t - q) + Kd (dq_t - dq) + tau_ff, clamped to
+   * the torque limit, against the link inertia, viscous and Coulomb friction
+   * and a gravity torque of -gravity * sin(q - gravityZero). The plant is
+   * integrated with a fixed step of substeps per control period; the PD
+   * terms are integrated implicitly, so stiff gains stay stable at the
+   * default 4 kHz plant rate. Until the first command the actuators are off.
+   *
+   * Each period the latest published command is applied, then ImuData and
+   * RobotState are delivered to the subscribe* callbacks, stamped with the
+   * simulated time. The base does not move: the IMU reports the orientation
+   * set with setBaseOrientation() and the matching gravity reaction. No
+   * sockets or other processes are involved, so controllers and abilities
+   * can run in CI on any machine.
+   *
+   * Example usage:
+   * @code
+   * limxsdk::Loopback *sim = limxsdk::Loopback::getInstance();
+   * sim->init("PointFoot");
+   * sim->setSpeed(limxsdk::Loopback::AS_FAST_AS_POSSIBLE);
+   * sim->setLockstep(true);
+   * MyController ctrl(sim);   // Subscribes its callbacks
+   * sim->start();
+   * @endcode
+   * Without start(), step() runs periods on the calling thread.
+   */
+  class LIMX_SDK_API Loopback : public ApiBase
+  {
+  public:
+    static constexpr double AS_FAST_AS_POSSIBLE = 0.0;
+
+    /**
+     * @brief Get an instance of the Loopback class.
+     * @return A pointer to a Loopback instance (Singleton pattern).
+     */
+    static Loopback *getInstance()
+    {
+      static Loopback instance;
+      return &instance;
+    }
+
+    /**
+     * @brief Selects the simulated joints and resets the simulation.
+     * @param model "PointFoot" (also for an empty string or an IP address), "SoleFoot" or "WheelFoot";
+     *              the joints are then in the order of the policy joint_names.
+     * @return False for an unknown model.
+     */
+    bool init(const std::string &model = "") override
+    {
+      stop();
+      std::vector<LoopbackJoint> leg;
+      leg.push_back(joint("abad", 0.1f, 1.1f, 80.0f));
+      leg.push_back(joint("hip", 0.08f, 3.2f, 80.0f));
+      leg.push_back(joint("knee", 0.03f, 0.6f, 80.0f));
+      if (model == "SoleFoot")
+      {
+        leg.push_back(joint("ankle", 0.005f, 0.2f, 20.0f));
+      }
+      else if (model == "WheelFoot")
+      {
+        leg.push_back(joint("wheel", 0.005f, 0.0f, 40.0f));
+      }
+      else if (!model.empty() && model != "PointFoot" && model.find_first_not_of("0123456789.") != std::string::npos)
+      {
+        std::cerr << "Unknown loopback model: " << model << " (expected PointFoot, SoleFoot or WheelFoot)" << std::endl;
+        return false;
+      }
+
+      std::vector<LoopbackJoint> joints;
+      for (const char *side : {"_L_Joint", "_R_Joint"})
+      {
+        for (LoopbackJoint j : leg)
+        {
+          j.name += side;
+          joints.push_back(j);
+        }
+      }
+      return setJoints(joints);
+    }
+
+    /**
+     * @brief Replaces the simulated joints and resets the simulation; not while running.
+     */
+    bool setJoints(const std::vector<LoopbackJoint> &joints)
+    {
+      if (running_ || joints.empty())
+      {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(command_mutex_);
+      joints_ = joints;
+      const size_t n = joints_.size();
+      state_ = RobotState(static_cast<int>(n));
+      for (size_t j = 0; j < n; ++j)
+      {
+        state_.q[j] = joints_[j].initial;
+        state_.motor_names[j] = joints_[j].name;
+      }
+      state_.stamp = 0;
+      command_ = RobotCmd(static_cast<int>(n));
+      has_command_ = false;
+      command_count_ = 0;
+      time_ = 0;
+      steps_ = 0;
+      return true;
+    }
+
+    const std::vector<LoopbackJoint> &joints() const { return joints_; }
+
+    uint32_t getMotorNumber() override { return static_cast<uint32_t>(joints_.size()); }
+
+    std::vector<std::string> getMotorNames() override { return state_.motor_names; }
+
+    void subscribeImuData(std::function<void(const ImuDataConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      imu_data_callback_.push_back(cb);
+    }
+
+    void subscribeRobotState(std::function<void(const RobotStateConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      robot_state_callback_.push_back(cb);
+    }
+
+    void subscribeSensorJoy(std::function<void(const SensorJoyConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      sensor_joy_callback_.push_back(cb);
+    }
+
+    void subscribeDiagnosticValue(std::function<void(const DiagnosticValueConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      diagnostic_callback_.push_back(cb);
+    }
+
+    /**
+     * @brief Receives the commands published by the code under test.
+     */
+    void subscribeRobotCmdForSim(std::function<void(const RobotCmdConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      robot_cmd_callback_.push_back(cb);
+    }
+
+    /**
+     * @brief Takes the command applied from the next simulated period on.
+     * @return False if the command has no joints.
+     */
+    bool publishRobotCmd(const RobotCmd &cmd) override
+    {
+      if (cmd.q.empty())
+      {
+        return false;
+      }
+      {
+        std::lock_guard<std::mutex> lock(command_mutex_);
+        const size_t n = std::min(command_.q.size(), cmd.q.size());
+        std::copy(cmd.q.begin(), cmd.q.begin() + n, command_.q.begin());
+        std::copy(cmd.dq.begin(), cmd.dq.begin() + std::min(n, cmd.dq.size()), command_.dq.begin());
+        std::copy(cmd.tau.begin(), cmd.tau.begin() + std::min(n, cmd.tau.size()), command_.tau.begin());
+        std::copy(cmd.Kp.begin(), cmd.Kp.begin() + std::min(n, cmd.Kp.size()), command_.Kp.begin());
+        std::copy(cmd.Kd.begin(), cmd.Kd.begin() + std::min(n, cmd.Kd.size()), command_.Kd.begin());
+        command_.stamp = cmd.stamp;
+        has_command_ = true;
+        command_count_++;
+      }
+      command_cv_.notify_all();
+
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      if (!robot_cmd_callback_.empty())
+      {
+        RobotCmdConstPtr msg = std::make_shared<RobotCmd>(cmd);
+        for (auto &cb : robot_cmd_callback_)
+        {
+          cb(msg);
+        }
+      }
+      return true;
+    }
+
+    bool publishRobotStateForSim(const RobotState & /*state*/) override { return false; }
+    bool publishImuDataForSim(const ImuData & /*imu*/) override { return false; }
+    bool setRobotLightEffect(int /*effect*/) override { return true; }
+    void publishDiagnostic(const std::string & /*name*/, const std::string & /*part*/, int /*code*/, int /*level*/ = 0,
+                           const std::string & /*message*/ = "") override {}
+    void publishJsonMessage(const std::string & /*json_payload*/) override {}
+
+    /**
+     * @brief Sets the control period to 1 / @p rate seconds and the plant step to 1 / (rate * substeps).
+     */
+    void setRate(double rate, int substeps = 4)
+    {
+      if (rate > 0.0 && substeps > 0 && !running_)
+      {
+        rate_ = rate;
+        substeps_ = substeps;
+      }
+    }
+
+    /**
+     * @brief Sets the pacing: 1.0 is real time, N runs N times faster,
+     *        AS_FAST_AS_POSSIBLE does not wait between periods. May be changed while running.
+     */
+    void setSpeed(double speed) { speed_ = speed < 0.0 ? 0.0 : speed; }
+
+    /**
+     * @brief In lockstep mode every RobotState is followed by a wait for one publishRobotCmd
+     *        (at most @p timeout_s seconds), so the controller sees every period. May be changed while running.
+     */
+    void setLockstep(bool enabled, double timeout_s = 1.0)
+    {
+      lockstep_timeout_ = timeout_s;
+      lockstep_ = enabled;
+    }
+
+    /**
+     * @brief Orientation of the fixed base as a quaternion (w, x, y, z), reported by the IMU.
+     */
+    void setBaseOrientation(float w, float x, float y, float z)
+    {
+      const float norm = std::sqrt(w * w + x * x + y * y + z * z);
+      if (norm > 0.0f)
+      {
+        std::lock_guard<std::mutex> lock(command_mutex_);
+        quat_[0] = w / norm;
+        quat_[1] = x / norm;
+        quat_[2] = y / norm;
+        quat_[3] = z / norm;
+      }
+    }
+
+    /**
+     * @brief Starts the simulation thread.
+     * @return False if no joints are configured or the simulation is already running.
+     */
+    bool start()
+    {
+      if (joints_.empty() || running_)
+      {
+        return false;
+      }
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+      running_ = true;
+      thread_ = std::thread(&Loopback::run, this);
+      return true;
+    }
+
+    void stop()
+    {
+      {
+        // Under the lock, so a lockstep wait cannot check the flag and then miss the wakeup
+        std::lock_guard<std::mutex> lock(command_mutex_);
+        running_ = false;
+      }
+      command_cv_.notify_all();
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+    }
+
+    bool isRunning() const { return running_; }
+
+    /**
+     * @brief Runs @p count periods on the calling thread, delivering the callbacks; not while running.
+     */
+    bool step(uint64_t count = 1)
+    {
+      if (running_ || joints_.empty())
+      {
+        return false;
+      }
+      for (uint64_t i = 0; i < count; ++i)
+      {
+        period();
+      }
+      return true;
+    }
+
+    /**
+     * @brief Simulated time in nanoseconds since init().
+     */
+    uint64_t currentTime() const { return time_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of periods simulated since init().
+     */
+    uint64_t stepCount() const { return steps_.load(std::memory_order_relaxed); }
+
+    uint64_t commandCount()
+    {
+      std::lock_guard<std::mutex> lock(command_mutex_);
+      return command_count_;
+    }
+
+    virtual ~Loopback() { stop(); }
+
+  private:
+    Loopback()
+        : rate_(1000.0), substeps_(4), speed_(1.0), lockstep_(false), lockstep_timeout_(1.0), has_command_(false),
+          command_count_(0), running_(false), time_(0), steps_(0)
+    {
+      quat_[0] = 1.0f;
+      quat_[1] = quat_[2] = quat_[3] = 0.0f;
+    }
+
+    static LoopbackJoint joint(const std::string &name, float inertia, float gravity, float torque_limit)
+    {
+      LoopbackJoint j;
+      j.name = name;
+      j.inertia = inertia;
+      j.gravity = gravity;
+      j.torqueLimit = torque_limit;
+      return j;
+    }
+
+    void run()
+    {
+      std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+      uint64_t sim_start = time_.load(std::memory_order_relaxed);
+      double speed = speed_;
+      while (running_)
+      {
+        const uint64_t commands = commandCount();
+        period();
+        if (lockstep_)
+        {
+          waitForCommand(commands);
+        }
+        if (speed_ != speed)
+        {
+          // Pace from here on at the new speed
+          speed = speed_;
+          wall_start = std::chrono::steady_clock::now();
+          sim_start = time_.load(std::memory_order_relaxed);
+        }
+        if (speed > 0.0)
+        {
+          std::this_thread::sleep_until(wall_start + std::chrono::nanoseconds(
+            static_cast<int64_t>((time_.load(std::memory_order_relaxed) - sim_start) / speed)));
+        }
+      }
+    }
+
+    void waitForCommand(uint64_t previous)
+    {
+      std::unique_lock<std::mutex> lock(command_mutex_);
+      command_cv_.wait_for(lock, std::chrono::duration<double>(lockstep_timeout_.load()), [this, previous]() {
+        return command_count_ != previous || !running_;
+      });
+    }
+
+    /**
+     * @brief Integrates one control period under the latest command and delivers the sensor messages.
+     */
+    void period()
+    {
+      std::shared_ptr<RobotState> state = std::make_shared<RobotState>();
+      std::shared_ptr<ImuData> imu = std::make_shared<ImuData>();
+      const uint64_t period_ns = static_cast<uint64_t>(1e9 / rate_ + 0.5);
+      {
+        std::lock_guard<std::mutex> lock(command_mutex_);
+        const float dt = static_cast<float>(1.0 / (rate_ * substeps_));
+        for (int s = 0; s < substeps_; ++s)
+        {
+          integrate(dt);
+        }
+        state_.stamp += period_ns;
+        *state = state_;
+
+        // Fixed base: the accelerometer measures the reaction to gravity in the base frame
+        const float w = quat_[0], x = quat_[1], y = quat_[2], z = quat_[3];
+        imu->stamp = state_.stamp;
+        imu->acc[0] = 9.81f * 2.0f * (x * z - w * y);
+        imu->acc[1] = 9.81f * 2.0f * (y * z + w * x);
+        imu->acc[2] = 9.81f * (1.0f - 2.0f * (x * x + y * y));
+        std::copy(quat_, quat_ + 4, imu->quat);
+      }
+      time_.store(state->stamp, std::memory_order_relaxed);
+      steps_.fetch_add(1, std::memory_order_relaxed);
+
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      for (auto &cb : imu_data_callback_)
+      {
+        cb(imu);
+      }
+      for (auto &cb : robot_state_callback_)
+      {
+        cb(state);
+      }
+    }
+
+    /**
+     * @brief One plant step of @p dt seconds; command_mutex_ is held.
+     *
+     * Unsaturated actuators are integrated with the PD torque at the end of
+     * the step (semi-implicit Euler with implicit PD terms); saturated ones
+     * with their clamped torque at the start of it.
+     */
+    void integrate(float dt)
+    {
+      for (size_t j = 0; j < joints_.size(); ++j)
+      {
+        const LoopbackJoint &p = joints_[j];
+        const float q = state_.q[j];
+        const float dq = state_.dq[j];
+        const float kp = has_command_ ? command_.Kp[j] : 0.0f;
+        const float kd = has_command_ ? command_.Kd[j] : 0.0f;
+        const float feed_forward = has_command_ ? command_.tau[j] : 0.0f;
+        const float position_error = has_command_ ? command_.q[j] - q : 0.0f;
+        const float velocity_target = has_command_ ? command_.dq[j] : 0.0f;
+
+        const float coulomb = dq > 0.0f ? -p.friction : (dq < 0.0f ? p.friction : 0.0f);
+        const float passive = -p.gravity * std::sin(q - p.gravityZero) + coulomb;
+        const float actuator = kp * position_error + kd * (velocity_target - dq) + feed_forward;
+
+        float next;
+        float torque;
+        if (std::fabs(actuator) <= p.torqueLimit)
+        {
+          next = (p.inertia * dq + dt * (kp * position_error + kd * velocity_target + feed_forward + passive)) /
+                 (p.inertia + dt * (kd + p.damping) + dt * dt * kp);
+          torque = kp * (position_error - dt * next) + kd * (velocity_target - next) + feed_forward;
+        }
+        else
+        {
+          torque = actuator > 0.0f ? p.torqueLimit : -p.torqueLimit;
+          next = (p.inertia * dq + dt * (torque + passive)) / (p.inertia + dt * p.damping);
+        }
+
+        // Hard stops absorb the motion into them
+        float position = q + dt * next;
+        if (position > p.upper)
+        {
+          position = p.upper;
+          next = std::min(next, 0.0f);
+        }
+        else if (position < p.lower)
+        {
+          position = p.lower;
+          next = std::max(next, 0.0f);
+        }
+        state_.q[j] = position;
+        state_.dq[j] = next;
+        state_.tau[j] = torque;
+      }
+    }
+
+    std::vector<LoopbackJoint> joints_;
+    double rate_;
+    int substeps_;
+    std::atomic<double> speed_;             // Read by the simulation thread
+    std::atomic<bool> lockstep_;
+    std::atomic<double> lockstep_timeout_;
+    float quat_[4];
+
+    std::recursive_mutex callback_mutex_;
+
+    std::mutex command_mutex_;
+    std::condition_variable command_cv_;
+    RobotState state_;
+    RobotCmd command_;
+    bool has_command_;
+    uint64_t command_count_;
+
+    std::atomic<bool> running_;
+    std::atomic<uint64_t> time_;
+    std::atomic<uint64_t> steps_;
+    std::thread thread_;
+  };
+}
+
+#endif
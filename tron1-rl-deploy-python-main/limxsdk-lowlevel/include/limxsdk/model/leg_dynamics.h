@@ -0,0 +1,319 @@
+/**
+ * @file leg_dynamics.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef LEG_DYNAMICS_H
+#define LEG_DYNAMICS_H
+
+#include <cmath>
+#include "limxsdk/macros.h"
+#include "limxsdk/model/leg_kinematics.h"
+
+namespace limxsdk {
+namespace model {
+
+/**
+ * @class LegDynamics
+ * @brief Recursive Newton-Euler inverse dynamics of both legs of a @p TYPE robot on a fixed base.
+ *
+ * Each leg is treated as a serial chain on a base that does not accelerate,
+ * with gravity given in the base frame, so the result is the torque that
+ * moves the legs' own links; the load a stance foot carries is not part of
+ * it. As in LegKinematics the geometry is mirrored once in the constructor,
+ * every intermediate is stored leg-minor and all loops have compile-time
+ * bounds, so with optimization both passes unroll into straight-line code.
+ * gravity() instantiates the recursion without the velocity terms.
+ */
+template <LegType TYPE>
+class LegDynamics {
+public:
+    static const int LEGS = 2;
+    static const int JOINTS = LegTraits<TYPE>::JOINTS;
+
+    explicit LegDynamics(const LegGeometry& geometry) {
+        for (int leg = 0; leg < LEGS; ++leg) {
+            // Mirroring in y flips y and the products of inertia with one y index
+            const float mirror = leg == 0 ? 1.0f : -1.0f;
+            for (int i = 0; i < JOINTS; ++i) {
+                const LinkInertia& link = geometry.link[i];
+                origin_[i][0][leg] = geometry.origin[i][0];
+                origin_[i][1][leg] = mirror * geometry.origin[i][1];
+                origin_[i][2][leg] = geometry.origin[i][2];
+                sign_[i][leg] = leg == 0 ? 1.0f : geometry.rightSign[i];
+                mass_[i][leg] = link.mass;
+                com_[i][0][leg] = link.com[0];
+                com_[i][1][leg] = mirror * link.com[1];
+                com_[i][2][leg] = link.com[2];
+                inertia_[i][0][leg] = link.inertia[0];
+                inertia_[i][1][leg] = link.inertia[1];
+                inertia_[i][2][leg] = link.inertia[2];
+                inertia_[i][3][leg] = mirror * link.inertia[3];
+                inertia_[i][4][leg] = link.inertia[4];
+                inertia_[i][5][leg] = mirror * link.inertia[5];
+            }
+        }
+        for (int i = 0; i < JOINTS; ++i) {
+            axis_[i] = geometry.axis[i];
+        }
+        valid_ = geometry.type == TYPE && geometry.joints == JOINTS;
+    }
+
+    /**
+     * @brief False if the geometry passed to the constructor is not a @p TYPE leg.
+     */
+    bool valid() const { return valid_; }
+
+    /**
+     * @brief Joint torques for the accelerations @p ddq at @p q and @p dq.
+     *
+     * All joint arrays hold LEGS * JOINTS values, left leg first, in
+     * LegGeometry joint order. @p gravity is the gravity vector in the base
+     * frame, e.g. projected gravity times 9.81.
+     */
+    void inverseDynamics(const float* q, const float* dq, const float* ddq, const float gravity[3],
+                         float* tau) const {
+        rnea<true>(q, dq, ddq, gravity, tau);
+    }
+
+    /**
+     * @brief Joint torques holding the legs still at @p q against @p gravity.
+     */
+    void gravity(const float* q, const float gravity[3], float* tau) const {
+        rnea<false>(q, nullptr, nullptr, gravity, tau);
+    }
+
+    /**
+     * @brief Kinetic energy of both legs relative to the base.
+     */
+    float kineticEnergy(const float* q, const float* dq) const {
+        Frames f;
+        frames(q, f);
+        float energy = 0.0f;
+        for (int leg = 0; leg < LEGS; ++leg) {
+            float w[3] = {0.0f, 0.0f, 0.0f};
+            float v[3] = {0.0f, 0.0f, 0.0f};        // Velocity of the current joint origin
+            float previous[3] = {0.0f, 0.0f, 0.0f};
+            for (int i = 0; i < JOINTS; ++i) {
+                float step[3];
+                float rc[3];
+                float wb[3];
+                float Iw[3];
+                for (int r = 0; r < 3; ++r) {
+                    step[r] = f.position[i][r][leg] - previous[r];
+                    previous[r] = f.position[i][r][leg];
+                }
+                addCross(w, step, v);
+                for (int r = 0; r < 3; ++r) {
+                    w[r] += f.axis[i][r][leg] * dq[leg * JOINTS + i];
+                    rc[r] = f.com[i][r][leg];
+                }
+                float vc[3] = {v[0], v[1], v[2]};
+                addCross(w, rc, vc);
+                toLink(f, i, leg, w, wb);
+                inertiaTimes(i, leg, wb, Iw);
+                energy += 0.5f * mass_[i][leg] * (vc[0] * vc[0] + vc[1] * vc[1] + vc[2] * vc[2]) +
+                          0.5f * (wb[0] * Iw[0] + wb[1] * Iw[1] + wb[2] * Iw[2]);
+            }
+        }
+        return energy;
+    }
+
+    /**
+     * @brief Potential energy of both legs in @p gravity, zero at the base origin.
+     */
+    float potentialEnergy(const float* q, const float gravity[3]) const {
+        Frames f;
+        frames(q, f);
+        float energy = 0.0f;
+        for (int i = 0; i < JOINTS; ++i) {
+            for (int leg = 0; leg < LEGS; ++leg) {
+                for (int r = 0; r < 3; ++r) {
+                    energy -= mass_[i][leg] * gravity[r] * (f.position[i][r][leg] + f.com[i][r][leg]);
+                }
+            }
+        }
+        return energy;
+    }
+
+private:
+    // Base-frame pose of every joint: origin, signed axis, link rotation and centre of mass offset
+    struct Frames {
+        float position[JOINTS][3][LEGS];
+        float axis[JOINTS][3][LEGS];
+        float rotation[JOINTS][9][LEGS];        // Link i to base, row major
+        float com[JOINTS][3][LEGS];             // Centre of mass of link i relative to joint i
+    };
+
+    void frames(const float* q, Frames& f) const {
+        float R[9][LEGS];
+        float p[3][LEGS];
+        for (int leg = 0; leg < LEGS; ++leg) {
+            for (int k = 0; k < 9; ++k) {
+                R[k][leg] = k % 4 == 0 ? 1.0f : 0.0f;
+            }
+            p[0][leg] = p[1][leg] = p[2][leg] = 0.0f;
+        }
+        for (int i = 0; i < JOINTS; ++i) {
+            const int a = axis_[i];
+            const int b = (a + 1) % 3;
+            const int d = (a + 2) % 3;
+            for (int leg = 0; leg < LEGS; ++leg) {
+                for (int r = 0; r < 3; ++r) {
+                    p[r][leg] += R[3 * r][leg] * origin_[i][0][leg] + R[3 * r + 1][leg] * origin_[i][1][leg] +
+                                 R[3 * r + 2][leg] * origin_[i][2][leg];
+                    f.position[i][r][leg] = p[r][leg];
+                    f.axis[i][r][leg] = sign_[i][leg] * R[3 * r + a][leg];
+                }
+                const float angle = sign_[i][leg] * q[leg * JOINTS + i];
+                const float c = std::cos(angle);
+                const float s = std::sin(angle);
+                for (int r = 0; r < 3; ++r) {
+                    const float rb = R[3 * r + b][leg];
+                    const float rd = R[3 * r + d][leg];
+                    R[3 * r + b][leg] = c * rb + s * rd;
+                    R[3 * r + d][leg] = -s * rb + c * rd;
+                }
+                for (int k = 0; k < 9; ++k) {
+                    f.rotation[i][k][leg] = R[k][leg];
+                }
+                for (int r = 0; r < 3; ++r) {
+                    f.com[i][r][leg] = R[3 * r][leg] * com_[i][0][leg] + R[3 * r + 1][leg] * com_[i][1][leg] +
+                                       R[3 * r + 2][leg] * com_[i][2][leg];
+                }
+            }
+        }
+    }
+
+    template <bool MOVING>
+    void rnea(const float* q, const float* dq, const float* ddq, const float gravity[3], float* tau) const {
+        Frames f;
+        frames(q, f);
+        float force[JOINTS][3][LEGS];           // Net force on link i
+        float moment[JOINTS][3][LEGS];          // Net moment on link i about its centre of mass
+
+        // Forward pass: link velocities and accelerations, base acceleration -gravity
+        for (int leg = 0; leg < LEGS; ++leg) {
+            float w[3] = {0.0f, 0.0f, 0.0f};
+            float wd[3] = {0.0f, 0.0f, 0.0f};
+            float a[3] = {-gravity[0], -gravity[1], -gravity[2]};
+            float previous[3] = {0.0f, 0.0f, 0.0f};
+            for (int i = 0; i < JOINTS; ++i) {
+                float rc[3] = {f.com[i][0][leg], f.com[i][1][leg], f.com[i][2][leg]};
+                float ac[3];
+                if (MOVING) {
+                    const int j = leg * JOINTS + i;
+                    float step[3];
+                    for (int r = 0; r < 3; ++r) {
+                        step[r] = f.position[i][r][leg] - previous[r];
+                        previous[r] = f.position[i][r][leg];
+                    }
+                    // Joint origin moves with the previous link
+                    float wxs[3] = {0.0f, 0.0f, 0.0f};
+                    addCross(w, step, wxs);
+                    addCross(wd, step, a);
+                    addCross(w, wxs, a);
+                    const float z[3] = {f.axis[i][0][leg], f.axis[i][1][leg], f.axis[i][2][leg]};
+                    const float spin[3] = {z[0] * dq[j], z[1] * dq[j], z[2] * dq[j]};
+                    addCross(w, spin, wd);
+                    for (int r = 0; r < 3; ++r) {
+                        wd[r] += z[r] * ddq[j];
+                        w[r] += spin[r];
+                    }
+                    float wxr[3] = {0.0f, 0.0f, 0.0f};
+                    addCross(w, rc, wxr);
+                    ac[0] = a[0];
+                    ac[1] = a[1];
+                    ac[2] = a[2];
+                    addCross(wd, rc, ac);
+                    addCross(w, wxr, ac);
+
+                    // Euler's equation in the link frame, rotated back
+                    float wb[3];
+                    float wdb[3];
+                    float Iw[3];
+                    float Iwd[3];
+                    toLink(f, i, leg, w, wb);
+                    toLink(f, i, leg, wd, wdb);
+                    inertiaTimes(i, leg, wb, Iw);
+                    inertiaTimes(i, leg, wdb, Iwd);
+                    addCross(wb, Iw, Iwd);
+                    for (int r = 0; r < 3; ++r) {
+                        moment[i][r][leg] = f.rotation[i][3 * r][leg] * Iwd[0] +
+                                            f.rotation[i][3 * r + 1][leg] * Iwd[1] +
+                                            f.rotation[i][3 * r + 2][leg] * Iwd[2];
+                    }
+                } else {
+                    ac[0] = a[0];
+                    ac[1] = a[1];
+                    ac[2] = a[2];
+                    moment[i][0][leg] = moment[i][1][leg] = moment[i][2][leg] = 0.0f;
+                }
+                for (int r = 0; r < 3; ++r) {
+                    force[i][r][leg] = mass_[i][leg] * ac[r];
+                }
+            }
+        }
+
+        // Backward pass: wrench each joint transmits, about the joint origin
+        for (int leg = 0; leg < LEGS; ++leg) {
+            float f_out[3] = {0.0f, 0.0f, 0.0f};
+            float n_out[3] = {0.0f, 0.0f, 0.0f};
+            for (int i = JOINTS - 1; i >= 0; --i) {
+                float n[3] = {moment[i][0][leg] + n_out[0], moment[i][1][leg] + n_out[1],
+                              moment[i][2][leg] + n_out[2]};
+                const float rc[3] = {f.com[i][0][leg], f.com[i][1][leg], f.com[i][2][leg]};
+                const float F[3] = {force[i][0][leg], force[i][1][leg], force[i][2][leg]};
+                addCross(rc, F, n);
+                if (i + 1 < JOINTS) {
+                    const float child[3] = {f.position[i + 1][0][leg] - f.position[i][0][leg],
+                                            f.position[i + 1][1][leg] - f.position[i][1][leg],
+                                            f.position[i + 1][2][leg] - f.position[i][2][leg]};
+                    addCross(child, f_out, n);
+                }
+                for (int r = 0; r < 3; ++r) {
+                    f_out[r] += F[r];
+                    n_out[r] = n[r];
+                }
+                tau[leg * JOINTS + i] =
+                    f.axis[i][0][leg] * n[0] + f.axis[i][1][leg] * n[1] + f.axis[i][2][leg] * n[2];
+            }
+        }
+    }
+
+    // out += a x b
+    static void addCross(const float a[3], const float b[3], float out[3]) {
+        out[0] += a[1] * b[2] - a[2] * b[1];
+        out[1] += a[2] * b[0] - a[0] * b[2];
+        out[2] += a[0] * b[1] - a[1] * b[0];
+    }
+
+    // Base-frame vector in the frame of link i: R^T v
+    static void toLink(const Frames& f, int i, int leg, const float v[3], float out[3]) {
+        for (int c = 0; c < 3; ++c) {
+            out[c] = f.rotation[i][c][leg] * v[0] + f.rotation[i][3 + c][leg] * v[1] + f.rotation[i][6 + c][leg] * v[2];
+        }
+    }
+
+    void inertiaTimes(int i, int leg, const float v[3], float out[3]) const {
+        const float xx = inertia_[i][0][leg], yy = inertia_[i][1][leg], zz = inertia_[i][2][leg];
+        const float xy = inertia_[i][3][leg], xz = inertia_[i][4][leg], yz = inertia_[i][5][leg];
+        out[0] = xx * v[0] + xy * v[1] + xz * v[2];
+        out[1] = xy * v[0] + yy * v[1] + yz * v[2];
+        out[2] = xz * v[0] + yz * v[1] + zz * v[2];
+    }
+
+    float origin_[JOINTS][3][LEGS];
+    float sign_[JOINTS][LEGS];
+    float mass_[JOINTS][LEGS];
+    float com_[JOINTS][3][LEGS];
+    float inertia_[JOINTS][6][LEGS];
+    int axis_[JOINTS];
+    bool valid_ = false;
+};
+
+} // namespace model
+} // namespace limxsdk
+
+#endif // LEG_DYNAMICS_H
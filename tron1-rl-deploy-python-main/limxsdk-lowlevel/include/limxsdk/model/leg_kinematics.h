@@ -0,0 +1,290 @@
+/**
+ * @file leg_kinematics.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef LEG_KINEMATICS_H
+#define LEG_KINEMATICS_H
+
+#include <cmath>
+#include <string>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace model {
+
+/**
+ * @brief Tron1 leg variants; each leg is abad, hip, knee and, for SOLEFOOT/WHEELFOOT, an ankle or wheel joint.
+ */
+enum class LegType {
+    POINTFOOT,
+    SOLEFOOT,
+    WHEELFOOT
+};
+
+inline bool parseLegType(const std::string& name, LegType& type) {
+    if (name == "PointFoot") {
+        type = LegType::POINTFOOT;
+    } else if (name == "SoleFoot") {
+        type = LegType::SOLEFOOT;
+    } else if (name == "WheelFoot") {
+        type = LegType::WHEELFOOT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @struct LinkInertia
+ * @brief Inertial values of the link moved by one joint, as in the URDF <inertial> of the left leg.
+ */
+struct LIMX_SDK_API LinkInertia {
+    float mass = 0.0f;
+    float com[3] = {};          // Centre of mass in the joint frame
+    float inertia[6] = {};      // About the centre of mass: xx, yy, zz, xy, xz, yz
+};
+
+/**
+ * @struct LegGeometry
+ * @brief Serial chain of one leg, given for the left leg as in a URDF with zero rpy on every joint.
+ *
+ * The right leg mirrors the left one in y; its joint axes are multiplied by
+ * rightSign, which for the Tron1 legs flips the hip and knee axes (see the
+ * mirrored joint_limits in the SF params.yaml files). The link inertias
+ * are only used by LegDynamics.
+ */
+struct LIMX_SDK_API LegGeometry {
+    static const int MAX_JOINTS = 4;
+
+    LegType type = LegType::POINTFOOT;
+    int joints = 3;
+    float origin[MAX_JOINTS][3] = {};     // Joint i relative to joint i - 1, joint 0 relative to the base
+    int axis[MAX_JOINTS] = {0, 1, 1, 1};  // Rotation axis of joint i: 0 x, 1 y, 2 z
+    float rightSign[MAX_JOINTS] = {1.0f, -1.0f, -1.0f, 1.0f};
+    float contact[3] = {};                // Foot point or sole centre in the last joint frame; wheel centre for WHEELFOOT
+    float wheelRadius = 0.0f;
+    LinkInertia link[MAX_JOINTS];         // Link i is the body turned by joint i
+
+    /**
+     * @brief Nominal Tron1-sized legs; replace the lengths and inertias with the URDF values of the actual robot.
+     */
+    static LegGeometry nominal(LegType type) {
+        LegGeometry g;
+        g.type = type;
+        g.joints = type == LegType::POINTFOOT ? 3 : 4;
+        const float origins[MAX_JOINTS][3] = {
+            {0.0f, 0.105f, -0.1f},     // base -> abad
+            {0.0f, 0.03f, 0.0f},       // abad -> hip
+            {0.0f, 0.0f, -0.22f},      // hip -> knee
+            {0.0f, 0.0f, -0.22f}};     // knee -> ankle or wheel
+        // Abad housing, thigh and shank as slender rods along their links
+        const float masses[3] = {1.5f, 1.6f, 0.6f};
+        const float coms[3][3] = {{0.0f, 0.03f, 0.0f}, {0.0f, 0.0f, -0.08f}, {0.0f, 0.0f, -0.1f}};
+        const float inertias[3][6] = {{0.002f, 0.002f, 0.002f, 0.0f, 0.0f, 0.0f},
+                                      {0.0065f, 0.0065f, 0.001f, 0.0f, 0.0f, 0.0f},
+                                      {0.0025f, 0.0025f, 0.0003f, 0.0f, 0.0f, 0.0f}};
+        for (int i = 0; i < MAX_JOINTS; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                g.origin[i][k] = origins[i][k];
+            }
+            if (i < 3) {
+                g.link[i].mass = masses[i];
+                for (int k = 0; k < 3; ++k) {
+                    g.link[i].com[k] = coms[i][k];
+                }
+                for (int k = 0; k < 6; ++k) {
+                    g.link[i].inertia[k] = inertias[i][k];
+                }
+            }
+        }
+        switch (type) {
+        case LegType::POINTFOOT:
+            g.contact[2] = -0.25f;         // Knee to the bottom of the foot sphere
+            break;
+        case LegType::SOLEFOOT:
+            g.contact[0] = 0.02f;
+            g.contact[2] = -0.04f;
+            g.link[3].mass = 0.3f;
+            g.link[3].com[0] = 0.02f;
+            g.link[3].com[2] = -0.03f;
+            g.link[3].inertia[0] = 0.0002f;
+            g.link[3].inertia[1] = 0.0005f;
+            g.link[3].inertia[2] = 0.0005f;
+            break;
+        case LegType::WHEELFOOT:
+            g.wheelRadius = 0.1f;
+            g.rightSign[3] = -1.0f;        // Wheel spins mirrored like the hip and knee
+            g.link[3].mass = 0.8f;
+            g.link[3].inertia[0] = 0.0022f;
+            g.link[3].inertia[1] = 0.004f; // Solid disc about its spin axis, m r^2 / 2
+            g.link[3].inertia[2] = 0.0022f;
+            break;
+        }
+        return g;
+    }
+};
+
+/**
+ * @brief Joint count of one leg of type @p TYPE.
+ */
+template <LegType TYPE>
+struct LegTraits {
+    static const int JOINTS = TYPE == LegType::POINTFOOT ? 3 : 4;
+    static const bool WHEEL = TYPE == LegType::WHEELFOOT;
+};
+
+/**
+ * @class LegKinematics
+ * @brief Forward kinematics and Jacobians of both legs of a @p TYPE robot, sized at compile time.
+ *
+ * The constructor mirrors the geometry into per-leg origins and axis signs
+ * once. compute() then walks both chains together: every intermediate is
+ * stored leg-minor (x[...][LEGS]), so the inner loops run over the legs
+ * with unit stride and no data-dependent branches, and nothing is
+ * allocated. The point of a leg is its foot point or sole centre, or the
+ * wheel centre for WHEELFOOT, whose wheel joint column stays zero because
+ * the spin does not move the centre; the wheel axis is returned instead.
+ */
+template <LegType TYPE>
+class LegKinematics {
+public:
+    static const int LEGS = 2;
+    static const int JOINTS = LegTraits<TYPE>::JOINTS;
+
+    struct State {
+        float position[LEGS][3];              // Base frame
+        float jacobian[LEGS][3][JOINTS];      // d position / d q of the leg's own joints
+        float wheelAxis[LEGS][3];             // Wheel spin axis in the base frame, WHEELFOOT only
+    };
+
+    explicit LegKinematics(const LegGeometry& geometry) {
+        for (int leg = 0; leg < LEGS; ++leg) {
+            const float mirror = leg == 0 ? 1.0f : -1.0f;
+            for (int i = 0; i < JOINTS; ++i) {
+                origin_[i][0][leg] = geometry.origin[i][0];
+                origin_[i][1][leg] = mirror * geometry.origin[i][1];
+                origin_[i][2][leg] = geometry.origin[i][2];
+                sign_[i][leg] = leg == 0 ? 1.0f : geometry.rightSign[i];
+            }
+            contact_[0][leg] = geometry.contact[0];
+            contact_[1][leg] = mirror * geometry.contact[1];
+            contact_[2][leg] = geometry.contact[2];
+        }
+        for (int i = 0; i < JOINTS; ++i) {
+            axis_[i] = geometry.axis[i];
+        }
+        valid_ = geometry.type == TYPE && geometry.joints == JOINTS;
+    }
+
+    /**
+     * @brief False if the geometry passed to the constructor is not a @p TYPE leg.
+     */
+    bool valid() const { return valid_; }
+
+    /**
+     * @param q LEGS * JOINTS joint positions, left leg first, in LegGeometry joint order.
+     */
+    void compute(const float* q, State& out) const {
+        // Running rotation (row major) and position of both chains in the base frame
+        float R[9][LEGS];
+        float p[3][LEGS];
+        float jointPos[JOINTS][3][LEGS];
+        float jointAxis[JOINTS][3][LEGS];
+        for (int leg = 0; leg < LEGS; ++leg) {
+            for (int k = 0; k < 9; ++k) {
+                R[k][leg] = k % 4 == 0 ? 1.0f : 0.0f;
+            }
+            p[0][leg] = p[1][leg] = p[2][leg] = 0.0f;
+        }
+        for (int i = 0; i < JOINTS; ++i) {
+            const int a = axis_[i];
+            const int b = (a + 1) % 3;
+            const int d = (a + 2) % 3;
+            for (int leg = 0; leg < LEGS; ++leg) {
+                for (int r = 0; r < 3; ++r) {
+                    p[r][leg] += R[3 * r][leg] * origin_[i][0][leg] + R[3 * r + 1][leg] * origin_[i][1][leg] +
+                                 R[3 * r + 2][leg] * origin_[i][2][leg];
+                    jointPos[i][r][leg] = p[r][leg];
+                    jointAxis[i][r][leg] = sign_[i][leg] * R[3 * r + a][leg];
+                }
+                // R = R * rot(axis, sign * q)
+                const float angle = sign_[i][leg] * q[leg * JOINTS + i];
+                const float c = std::cos(angle);
+                const float s = std::sin(angle);
+                for (int r = 0; r < 3; ++r) {
+                    const float rb = R[3 * r + b][leg];
+                    const float rd = R[3 * r + d][leg];
+                    R[3 * r + b][leg] = c * rb + s * rd;
+                    R[3 * r + d][leg] = -s * rb + c * rd;
+                }
+            }
+        }
+
+        for (int leg = 0; leg < LEGS; ++leg) {
+            for (int r = 0; r < 3; ++r) {
+                if (LegTraits<TYPE>::WHEEL) {
+                    // The centre sits on the wheel axis, so the wheel angle does not move it
+                    out.position[leg][r] = jointPos[JOINTS - 1][r][leg];
+                    out.wheelAxis[leg][r] = jointAxis[JOINTS - 1][r][leg];
+                } else {
+                    out.position[leg][r] = p[r][leg] + R[3 * r][leg] * contact_[0][leg] +
+                                           R[3 * r + 1][leg] * contact_[1][leg] + R[3 * r + 2][leg] * contact_[2][leg];
+                    out.wheelAxis[leg][r] = 0.0f;
+                }
+            }
+            // Column i = axis_i x (point - joint_i)
+            for (int i = 0; i < JOINTS; ++i) {
+                const float w[3] = {jointAxis[i][0][leg], jointAxis[i][1][leg], jointAxis[i][2][leg]};
+                const float l[3] = {out.position[leg][0] - jointPos[i][0][leg],
+                                    out.position[leg][1] - jointPos[i][1][leg],
+                                    out.position[leg][2] - jointPos[i][2][leg]};
+                const float keep = LegTraits<TYPE>::WHEEL && i == JOINTS - 1 ? 0.0f : 1.0f;
+                out.jacobian[leg][0][i] = keep * (w[1] * l[2] - w[2] * l[1]);
+                out.jacobian[leg][1][i] = keep * (w[2] * l[0] - w[0] * l[2]);
+                out.jacobian[leg][2][i] = keep * (w[0] * l[1] - w[1] * l[0]);
+            }
+        }
+    }
+
+    /**
+     * @brief Point velocities J * dq from the joint velocities, laid out like q.
+     */
+    static void velocity(const State& state, const float* dq, float v[LEGS][3]) {
+        for (int leg = 0; leg < LEGS; ++leg) {
+            for (int r = 0; r < 3; ++r) {
+                float sum = 0.0f;
+                for (int i = 0; i < JOINTS; ++i) {
+                    sum += state.jacobian[leg][r][i] * dq[leg * JOINTS + i];
+                }
+                v[leg][r] = sum;
+            }
+        }
+    }
+
+    /**
+     * @brief Joint torques J^T * f holding the point forces @p force, laid out like q.
+     */
+    static void torques(const State& state, const float force[LEGS][3], float* tau) {
+        for (int leg = 0; leg < LEGS; ++leg) {
+            for (int i = 0; i < JOINTS; ++i) {
+                tau[leg * JOINTS + i] = state.jacobian[leg][0][i] * force[leg][0] +
+                                        state.jacobian[leg][1][i] * force[leg][1] +
+                                        state.jacobian[leg][2][i] * force[leg][2];
+            }
+        }
+    }
+
+private:
+    float origin_[JOINTS][3][LEGS];
+    float sign_[JOINTS][LEGS];
+    float contact_[3][LEGS];
+    int axis_[JOINTS];
+    bool valid_ = false;
+};
+
+} // namespace model
+} // namespace limxsdk
+
+#endif // LEG_KINEMATICS_H
@@ -0,0 +1,486 @@
+/**
+ * @file replay.h
+ *
+ * @brief This file contains the declarations of classes related to replaying recorded robot logs.
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef _LIMX_SDK_REPLAY_H_
+#define _LIMX_SDK_REPLAY_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/apibase.h"
+#include "limxsdk/ability/flight_log.h"
+
+namespace limxsdk
+{
+  /**
+   * @brief A RobotCmd published by the code under test, stamped with the log time it was published at.
+   */
+  struct ReplayCommand
+  {
+    uint64_t time; // Log time (steady clock nanoseconds of the recording)
+    RobotCmd cmd;
+  };
+
+  /**
+   * @brief Robot backend that plays a flight recorder log instead of talking to a robot.
+   *
+   * Recorded RobotState, ImuData, SensorJoy and DiagnosticValue messages are
+   * delivered to the subscribe* callbacks from a single playback thread in log
+   * order, so a replay is repeatable. Commands passed to publishRobotCmd are
+   * counted and, with setCaptureCommands(true), kept for takeCapturedCommands()
+   * instead of being sent anywhere.
+   *
+   * Example usage:
+   * @code
+   * limxsdk::Replay *replay = limxsdk::Replay::getInstance();
+   * replay->init("/var/log/limx/20250101_120000");
+   * replay->setSpeed(limxsdk::Replay::AS_FAST_AS_POSSIBLE);
+   * replay->setLockstep(true);
+   * MyController ctrl(replay);   // Subscribes its callbacks
+   * replay->start();
+   * replay->wait();
+   * @endcode
+   */
+  class LIMX_SDK_API Replay : public ApiBase
+  {
+  public:
+    static constexpr double AS_FAST_AS_POSSIBLE = 0.0;
+    static const size_t DEFAULT_CAPTURE_LIMIT = 1 << 20;
+
+    /**
+     * @brief Get an instance of the Replay class.
+     * @return A pointer to a Replay instance (Singleton pattern).
+     */
+    static Replay *getInstance()
+    {
+      static Replay instance;
+      return &instance;
+    }
+
+    /**
+     * @brief Opens a recording.
+     * @param log_path A recording directory containing flight_*.seg files, or a single .seg file such as a dump.
+     * @return True if at least one valid segment was found.
+     */
+    bool init(const std::string &log_path = "") override
+    {
+      stop();
+      segments_.clear();
+      if (log_path.size() > 4 && log_path.compare(log_path.size() - 4, 4, ".seg") == 0)
+      {
+        segments_.push_back(log_path);
+      }
+      else
+      {
+        segments_ = ability::flight_log::listSegments(log_path);
+      }
+
+      // Take the motor count from the first recorded state
+      motor_number_ = 0;
+      for (const auto &path : segments_)
+      {
+        ability::FlightSegmentReader reader;
+        ability::FlightRecordView record;
+        if (!reader.open(path))
+        {
+          continue;
+        }
+        while (motor_number_ == 0 && reader.next(record))
+        {
+          RobotState state;
+          if (record.decode(state))
+          {
+            motor_number_ = static_cast<uint32_t>(state.q.size());
+          }
+        }
+        if (motor_number_ != 0)
+        {
+          break;
+        }
+      }
+
+      if (segments_.empty())
+      {
+        std::cerr << "No flight log segments found at: " << log_path << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    /**
+     * @brief Get the number of motors, taken from the first RobotState of the log.
+     */
+    uint32_t getMotorNumber() override { return motor_number_; }
+
+    /**
+     * @brief Logs do not store motor names; generic names are returned.
+     */
+    std::vector<std::string> getMotorNames() override
+    {
+      std::vector<std::string> names;
+      for (uint32_t i = 0; i < motor_number_; ++i)
+      {
+        names.push_back("joint_" + std::to_string(i));
+      }
+      return names;
+    }
+
+    void subscribeImuData(std::function<void(const ImuDataConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      imu_data_callback_.push_back(cb);
+    }
+
+    void subscribeRobotState(std::function<void(const RobotStateConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      robot_state_callback_.push_back(cb);
+    }
+
+    void subscribeSensorJoy(std::function<void(const SensorJoyConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      sensor_joy_callback_.push_back(cb);
+    }
+
+    void subscribeDiagnosticValue(std::function<void(const DiagnosticValueConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      diagnostic_callback_.push_back(cb);
+    }
+
+    /**
+     * @brief Receives the commands published by the code under test, as a simulator would.
+     */
+    void subscribeRobotCmdForSim(std::function<void(const RobotCmdConstPtr &)> cb) override
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      robot_cmd_callback_.push_back(cb);
+    }
+
+    /**
+     * @brief Receives the RobotCmd records of the log, e.g. to compare them against the captured output.
+     */
+    void subscribeRecordedRobotCmd(std::function<void(const RobotCmdConstPtr &)> cb)
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      recorded_cmd_callback_.push_back(cb);
+    }
+
+    /**
+     * @brief Captures a command of the code under test.
+     * @return Always true.
+     */
+    bool publishRobotCmd(const RobotCmd &cmd) override
+    {
+      {
+        std::lock_guard<std::mutex> lock(capture_mutex_);
+        if (capture_commands_ && captured_.size() < capture_limit_)
+        {
+          ReplayCommand captured;
+          captured.time = current_time_.load(std::memory_order_relaxed);
+          captured.cmd = cmd;
+          captured_.push_back(captured);
+        }
+        command_count_++;
+      }
+      capture_cv_.notify_all();
+
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      if (!robot_cmd_callback_.empty())
+      {
+        RobotCmdConstPtr msg = std::make_shared<RobotCmd>(cmd);
+        for (auto &cb : robot_cmd_callback_)
+        {
+          cb(msg);
+        }
+      }
+      return true;
+    }
+
+    bool publishRobotStateForSim(const RobotState & /*state*/) override { return false; }
+    bool publishImuDataForSim(const ImuData & /*imu*/) override { return false; }
+    bool setRobotLightEffect(int /*effect*/) override { return true; }
+    void publishDiagnostic(const std::string & /*name*/, const std::string & /*part*/, int /*code*/, int /*level*/ = 0,
+                           const std::string & /*message*/ = "") override {}
+    void publishJsonMessage(const std::string & /*json_payload*/) override {}
+
+    /**
+     * @brief Sets the playback speed: 1.0 is real time, N plays N times faster,
+     *        AS_FAST_AS_POSSIBLE does not wait between messages. May be changed while playing.
+     */
+    void setSpeed(double speed) { speed_ = speed < 0.0 ? 0.0 : speed; }
+
+    /**
+     * @brief Restarts from the beginning of the log when the end is reached.
+     */
+    void setLoop(bool loop) { loop_ = loop; }
+
+    /**
+     * @brief In lockstep mode every RobotState is followed by a wait for one publishRobotCmd
+     *        (at most @p timeout_s seconds), pairing controller output with its input state.
+     */
+    void setLockstep(bool enabled, double timeout_s = 1.0)
+    {
+      lockstep_timeout_ = timeout_s;
+      lockstep_ = enabled;
+    }
+
+    /**
+     * @brief Keeps published commands in memory until takeCapturedCommands(); off by default.
+     * @param limit Commands kept between two takeCapturedCommands() calls; later ones are only counted.
+     */
+    void setCaptureCommands(bool enabled, size_t limit = DEFAULT_CAPTURE_LIMIT)
+    {
+      std::lock_guard<std::mutex> lock(capture_mutex_);
+      capture_commands_ = enabled;
+      capture_limit_ = limit;
+    }
+
+    /**
+     * @brief Starts the playback thread.
+     * @return False if no log is open or playback is already running.
+     */
+    bool start()
+    {
+      if (segments_.empty() || playing_)
+      {
+        return false;
+      }
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+      playing_ = true;
+      thread_ = std::thread(&Replay::playback, this);
+      return true;
+    }
+
+    void stop()
+    {
+      {
+        // Under the lock, so a lockstep wait cannot check the flag and then miss the wakeup
+        std::lock_guard<std::mutex> lock(capture_mutex_);
+        playing_ = false;
+      }
+      capture_cv_.notify_all();
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+    }
+
+    /**
+     * @brief Blocks until playback reaches the end of the log or is stopped.
+     */
+    void wait()
+    {
+      if (thread_.joinable())
+      {
+        thread_.join();
+      }
+    }
+
+    bool isPlaying() const { return playing_; }
+
+    /**
+     * @brief Log time of the message being delivered, in steady clock nanoseconds of the recording.
+     */
+    uint64_t currentTime() const { return current_time_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Number of records delivered since start().
+     */
+    uint64_t deliveredCount() const { return delivered_.load(std::memory_order_relaxed); }
+
+    std::vector<ReplayCommand> takeCapturedCommands()
+    {
+      std::lock_guard<std::mutex> lock(capture_mutex_);
+      std::vector<ReplayCommand> out;
+      out.swap(captured_);
+      return out;
+    }
+
+    virtual ~Replay() { stop(); }
+
+  private:
+    Replay()
+        : motor_number_(0), speed_(1.0), loop_(false), lockstep_(false), lockstep_timeout_(1.0),
+          capture_commands_(false), capture_limit_(DEFAULT_CAPTURE_LIMIT), command_count_(0), playing_(false),
+          current_time_(0), delivered_(0) {}
+
+    void playback()
+    {
+      delivered_ = 0;
+      do
+      {
+        std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+        uint64_t log_start = 0;
+        double speed = speed_;
+        for (size_t i = 0; i < segments_.size() && playing_; ++i)
+        {
+          ability::FlightSegmentReader reader;
+          if (!reader.open(segments_[i]))
+          {
+            continue;
+          }
+          ability::FlightRecordView record;
+          while (playing_ && reader.next(record))
+          {
+            if (log_start == 0)
+            {
+              log_start = record.time();
+            }
+            if (speed_ != speed)
+            {
+              // Pace from here on at the new speed
+              speed = speed_;
+              wall_start = std::chrono::steady_clock::now();
+              log_start = record.time();
+            }
+            if (speed > 0.0 && record.time() > log_start)
+            {
+              std::this_thread::sleep_until(wall_start + std::chrono::nanoseconds(
+                static_cast<int64_t>((record.time() - log_start) / speed)));
+            }
+            current_time_.store(record.time(), std::memory_order_relaxed);
+            deliver(record);
+            delivered_.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      } while (loop_ && playing_);
+      playing_ = false;
+    }
+
+    void deliver(const ability::FlightRecordView &record)
+    {
+      std::lock_guard<std::recursive_mutex> lock(callback_mutex_);
+      switch (record.type())
+      {
+      case ability::FLIGHT_RECORD_ROBOT_STATE:
+      {
+        std::shared_ptr<RobotState> msg = std::make_shared<RobotState>();
+        if (record.decode(*msg))
+        {
+          uint64_t commands = commandCount();
+          for (auto &cb : robot_state_callback_)
+          {
+            cb(msg);
+          }
+          if (lockstep_)
+          {
+            waitForCommand(commands);
+          }
+        }
+        break;
+      }
+      case ability::FLIGHT_RECORD_IMU_DATA:
+      {
+        std::shared_ptr<ImuData> msg = std::make_shared<ImuData>();
+        if (record.decode(*msg))
+        {
+          for (auto &cb : imu_data_callback_)
+          {
+            cb(msg);
+          }
+        }
+        break;
+      }
+      case ability::FLIGHT_RECORD_SENSOR_JOY:
+      {
+        std::shared_ptr<SensorJoy> msg = std::make_shared<SensorJoy>();
+        if (record.decode(*msg))
+        {
+          for (auto &cb : sensor_joy_callback_)
+          {
+            cb(msg);
+          }
+        }
+        break;
+      }
+      case ability::FLIGHT_RECORD_DIAGNOSTIC:
+      {
+        std::shared_ptr<DiagnosticValue> msg = std::make_shared<DiagnosticValue>();
+        if (record.decode(*msg))
+        {
+          for (auto &cb : diagnostic_callback_)
+          {
+            cb(msg);
+          }
+        }
+        break;
+      }
+      case ability::FLIGHT_RECORD_ROBOT_CMD:
+      {
+        if (!recorded_cmd_callback_.empty())
+        {
+          std::shared_ptr<RobotCmd> msg = std::make_shared<RobotCmd>();
+          if (record.decode(*msg))
+          {
+            for (auto &cb : recorded_cmd_callback_)
+            {
+              cb(msg);
+            }
+          }
+        }
+        break;
+      }
+      default:
+        break;
+      }
+    }
+
+    uint64_t commandCount()
+    {
+      std::lock_guard<std::mutex> lock(capture_mutex_);
+      return command_count_;
+    }
+
+    void waitForCommand(uint64_t previous)
+    {
+      // The callback lock is held here; publishRobotCmd only needs capture_mutex_ until it
+      // has counted the command, so the code under test can always make progress
+      std::unique_lock<std::mutex> lock(capture_mutex_);
+      capture_cv_.wait_for(lock, std::chrono::duration<double>(lockstep_timeout_.load()), [this, previous]() {
+        return command_count_ != previous || !playing_;
+      });
+    }
+
+    std::vector<std::string> segments_;
+    uint32_t motor_number_;
+    std::atomic<double> speed_;             // Read by the playback thread
+    std::atomic<bool> loop_;
+    std::atomic<bool> lockstep_;
+    std::atomic<double> lockstep_timeout_;
+
+    std::vector<std::function<void(const RobotCmdConstPtr &)>> recorded_cmd_callback_;
+    std::recursive_mutex callback_mutex_;
+
+    std::mutex capture_mutex_;
+    std::condition_variable capture_cv_;
+    bool capture_commands_;
+    size_t capture_limit_;
+    uint64_t command_count_;
+    std::vector<ReplayCommand> captured_;
+
+    std::atomic<bool> playing_;
+    std::atomic<uint64_t> current_time_;
+    std::atomic<uint64_t> delivered_;
+    std::thread thread_;
+  };
+}
+
+#endif
@@ -0,0 +1,188 @@
+/**
+ * @file async_encoder.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef ASYNC_ENCODER_H
+#define ASYNC_ENCODER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/inference_session.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class AsyncEncoder
+ * @brief Runs an encoder on a helper thread, one request at a time.
+ *
+ * submit() hands the helper an input that must stay unchanged until wait()
+ * has returned; wait() blocks until the result is there and copies it out.
+ * The session is used by the helper between the two calls only, so the
+ * caller may run it itself whenever nothing is pending.
+ *
+ * The helper sleeps on a condition variable between requests. The caller
+ * normally finds the result ready, so wait() spins on a flag instead of
+ * sleeping to keep the hand-over cheap on the control thread.
+ */
+class LIMX_SDK_API AsyncEncoder {
+public:
+    ~AsyncEncoder() { stop(); }
+
+    /**
+     * @brief Starts the helper thread for @p encoder, pinned to CPU @p cpu if it is not negative.
+     */
+    bool start(InferenceSession* encoder, int cpu) {
+        stop();
+        encoder_ = encoder;
+        output_.assign(encoder->outputSize(), 0.0f);
+        quit_ = false;
+        requested_ = false;
+        pending_ = false;
+        done_.store(false, std::memory_order_relaxed);
+        thread_ = std::thread(&AsyncEncoder::loop, this);
+        if (cpu >= 0 && !pin(cpu)) {
+            std::cerr << "Warning: cannot pin the encoder thread to CPU " << cpu << std::endl;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Waits for a pending request and ends the helper thread.
+     */
+    void stop() {
+        if (!thread_.joinable()) {
+            return;
+        }
+        if (pending_) {
+            wait(nullptr);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            quit_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    bool running() const { return thread_.joinable(); }
+    bool pending() const { return pending_; }
+
+    /**
+     * @brief Starts encoding @p input on the helper thread. Nothing may be pending.
+     */
+    void submit(const float* input) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            input_ = input;
+            requested_ = true;
+        }
+        pending_ = true;
+        wake_.notify_one();
+    }
+
+    /**
+     * @brief Blocks until the pending request is done and copies its outputSize() floats to @p output.
+     * @param output Destination, or null to discard the result.
+     * @return False if nothing was pending or the encoder failed.
+     */
+    bool wait(float* output) {
+        if (!pending_) {
+            return false;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        for (int spins = 0; !done_.load(std::memory_order_acquire); ++spins) {
+            if (spins > 1000) {
+                std::this_thread::yield();
+            }
+        }
+        waitNs_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        done_.store(false, std::memory_order_relaxed);
+        pending_ = false;
+        if (output) {
+            std::copy(output_.begin(), output_.end(), output);
+        }
+        return ok_;
+    }
+
+    /**
+     * @brief Encoder time of the last completed request, spent on the helper thread.
+     */
+    int64_t runNs() const { return runNs_; }
+
+    /**
+     * @brief Time the last wait() blocked the caller.
+     */
+    int64_t waitNs() const { return waitNs_; }
+
+private:
+    void loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            wake_.wait(lock, [this] { return requested_ || quit_; });
+            if (quit_) {
+                return;
+            }
+            requested_ = false;
+            const float* input = input_;
+            lock.unlock();
+
+            const auto start = std::chrono::steady_clock::now();
+            ok_ = encoder_->run(input, output_.data());
+            runNs_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            done_.store(true, std::memory_order_release);
+
+            lock.lock();
+        }
+    }
+
+    bool pin(int cpu) {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(thread_.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)cpu;
+        return false;
+#endif
+    }
+
+    InferenceSession* encoder_ = nullptr;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    const float* input_ = nullptr;   // Guarded by mutex_ with requested_ and quit_
+    bool requested_ = false;
+    bool quit_ = false;
+
+    // Written by the helper before done_ is set, read by the caller after it
+    std::vector<float> output_;
+    bool ok_ = true;
+    int64_t runNs_ = 0;
+    std::atomic<bool> done_{false};
+
+    bool pending_ = false;           // Caller side only
+    int64_t waitNs_ = 0;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // ASYNC_ENCODER_H
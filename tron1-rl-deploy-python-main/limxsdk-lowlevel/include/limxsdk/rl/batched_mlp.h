@@ -0,0 +1,111 @@
+/**
+ * @file batched_mlp.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef BATCHED_MLP_H
+#define BATCHED_MLP_H
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/mlp_kernels.h"
+#include "limxsdk/rl/mlp_session.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class BatchedMlp
+ * @brief Several fp32 MlpNetworks evaluated together on inputs that share a common tail.
+ *
+ * Network i takes [private_i, shared], where private_i has its own length
+ * (possibly zero) and shared is the same vector for all networks. The
+ * first-layer rows that read the shared part are packed side by side into
+ * one in x (sum of strides) matrix, so a single GEMV reads the shared input
+ * once for all networks; only the private rows and the later layers run
+ * per network. The networks are referenced, not copied, and must outlive
+ * the batch.
+ */
+class LIMX_SDK_API BatchedMlp {
+public:
+    /**
+     * @param privateSizes Length of private_i for each network; the rest of its input is shared.
+     */
+    bool build(const std::vector<MlpNetwork*>& networks, const std::vector<int>& privateSizes) {
+        networks_ = networks;
+        privateSizes_ = privateSizes;
+        offsets_.clear();
+        if (networks.empty() || networks.size() != privateSizes.size()) {
+            return false;
+        }
+        shared_ = static_cast<int>(networks.front()->inputSize()) - privateSizes.front();
+        int stride = 0;
+        for (size_t n = 0; n < networks.size(); ++n) {
+            const DenseLayer& first = networks[n]->layers().front();
+            if (first.precision != Precision::FP32 || first.in - privateSizes[n] != shared_ || shared_ <= 0) {
+                std::cerr << "Batched MLP: network " << n << " is not fp32 or does not share a " << shared_
+                          << " value input" << std::endl;
+                return false;
+            }
+            offsets_.push_back(stride);
+            stride += first.stride;
+        }
+        stride_ = stride;
+
+        weights_.resize(static_cast<size_t>(shared_) * stride_);
+        bias_.resize(stride_);
+        for (size_t n = 0; n < networks.size(); ++n) {
+            const DenseLayer& first = networks[n]->layers().front();
+            for (int i = 0; i < shared_; ++i) {
+                const float* row = first.weights.data() + static_cast<size_t>(privateSizes[n] + i) * first.stride;
+                std::copy(row, row + first.stride, weights_.data() + static_cast<size_t>(i) * stride_ + offsets_[n]);
+            }
+            std::copy(first.bias.data(), first.bias.data() + first.stride, bias_.data() + offsets_[n]);
+        }
+        fused_.resize(stride_);
+        scratch_.resize(stride_);
+        kernel_ = mlp_kernels::select(networks.front()->kernelName());
+        return true;
+    }
+
+    size_t size() const { return networks_.size(); }
+    size_t sharedSize() const { return static_cast<size_t>(shared_); }
+
+    /**
+     * @brief Runs every network; @p privates[i] may be null if its private length is zero.
+     */
+    void run(const float* shared, const float* const* privates, float* const* outputs) {
+        kernel_.gemv(shared, shared_, weights_.data(), stride_, bias_.data(), fused_.data());
+        for (size_t n = 0; n < networks_.size(); ++n) {
+            float* y = fused_.data() + offsets_[n];
+            if (privateSizes_[n] > 0) {
+                // Add the private rows on top of the shared part, which acts as the bias here
+                const DenseLayer& first = networks_[n]->layers().front();
+                float* sum = scratch_.data() + offsets_[n];
+                kernel_.gemv(privates[n], privateSizes_[n], first.weights.data(), first.stride, y, sum);
+                y = sum;
+            }
+            networks_[n]->runFromFirstLayer(y, outputs[n]);
+        }
+    }
+
+private:
+    std::vector<MlpNetwork*> networks_;
+    std::vector<int> privateSizes_;
+    std::vector<int> offsets_;      // Column of each network in the fused layer
+    int shared_ = 0;
+    int stride_ = 0;
+    AlignedBuffer weights_;         // shared_ x stride_, input-major like DenseLayer
+    AlignedBuffer bias_;
+    AlignedBuffer fused_;
+    AlignedBuffer scratch_;
+    mlp_kernels::Kernel kernel_ = mlp_kernels::select("scalar");
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // BATCHED_MLP_H
@@ -0,0 +1,50 @@
+/**
+ * @file inference_session.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef INFERENCE_SESSION_H
+#define INFERENCE_SESSION_H
+
+#include <cstddef>
+#include <string>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class InferenceSession
+ * @brief A loaded network with one flat float input and one flat float output.
+ *
+ * The bundled encoders and policies are single-input MLPs, so run() takes
+ * caller-owned buffers and must not allocate once load() has returned.
+ */
+class LIMX_SDK_API InferenceSession {
+public:
+    virtual ~InferenceSession() = default;
+
+    /**
+     * @brief Loads the model at @p path. Prints the reason and returns false on failure.
+     */
+    virtual bool load(const std::string& path) = 0;
+
+    virtual size_t inputSize() const = 0;
+    virtual size_t outputSize() const = 0;
+
+    /**
+     * @brief Evaluates the network on inputSize() floats and writes outputSize() floats.
+     */
+    virtual bool run(const float* input, float* output) = 0;
+
+    /**
+     * @brief Backend name, as accepted by createInferenceSession().
+     */
+    virtual const char* backend() const = 0;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // INFERENCE_SESSION_H
@@ -0,0 +1,187 @@
+/**
+ * @file joint_safety.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef JOINT_SAFETY_H
+#define JOINT_SAFETY_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/rl/policy_config.h"
+
+// The command, the state and the limits never overlap; without this the compiler
+// would need a runtime overlap check for every pair of arrays and gives up
+#if defined(__clang__)
+#define LIMX_JOINT_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define LIMX_JOINT_LOOP _Pragma("GCC ivdep")
+#else
+#define LIMX_JOINT_LOOP
+#endif
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @struct JointSafetyCounters
+ * @brief Control ticks in which each limit changed the command of one joint.
+ */
+struct LIMX_SDK_API JointSafetyCounters {
+    uint64_t position = 0;      // Target outside [lower, upper]
+    uint64_t velocity = 0;      // Velocity target beyond the velocity limit
+    uint64_t torque = 0;        // Feed-forward or PD torque beyond the effort limit
+};
+
+/**
+ * @class JointSafety
+ * @brief Last clamp of a RobotCmd before it is published, over all joints in one pass.
+ *
+ * In this order, per joint:
+ *   - the position target is clamped to [lower, upper] and the velocity
+ *     target to +-velocity (the URDF joint_limits);
+ *   - the feed-forward torque is clamped to +-effort;
+ *   - the position target (or, with Kp = 0, the velocity target) is moved
+ *     until Kp (q_t - q) + Kd (dq_t - dq) + tau_ff stays within +-effort.
+ * The effort is the smaller of the joint_limits effort and the torque limit
+ * the controllers use for the joint kind, so the stage is the
+ * mode-independent version of the clamp the walk controller applies to its
+ * actions. When the measured joint is outside its position range the
+ * torque bound wins and the target approaches the limit at the effort
+ * limit. Limits and counters are kept as one array per quantity and the
+ * loop has no branches on the data, so the compiler vectorizes it across
+ * the joints; configure() is the only call that allocates.
+ */
+class LIMX_SDK_API JointSafety {
+public:
+    /**
+     * @brief Takes the joint_limits and torque limits of @p config; its joints are the command order.
+     */
+    void configure(const PolicyConfig& config) {
+        setLimits(config);
+        const size_t n = config.jointNames.size();
+        positionCount_.assign(n, 0);
+        velocityCount_.assign(n, 0);
+        torqueCount_.assign(n, 0);
+        ticks_ = 0;
+    }
+
+    /**
+     * @brief Replaces the limits with those of @p config, which drives the same joints; keeps the counters.
+     *        Does not allocate, so it may be called between apply() calls when the policy changes.
+     */
+    void setLimits(const PolicyConfig& config) {
+        const size_t n = config.jointNames.size();
+        lower_.resize(n);
+        upper_.resize(n);
+        velocity_.resize(n);
+        effort_.resize(n);
+        for (size_t j = 0; j < n; ++j) {
+            const JointLimit& limit = j < config.jointLimits.size() ? config.jointLimits[j] : JointLimit();
+            float torque = config.torqueLimit;
+            if (config.jointKinds[j] == JointKind::ANKLE) {
+                torque = config.ankleTorqueLimit;
+            } else if (config.jointKinds[j] == JointKind::WHEEL) {
+                torque = config.wheelTorqueLimit;
+            }
+            lower_[j] = limit.lower;
+            upper_[j] = limit.upper;
+            velocity_[j] = limit.velocity;
+            effort_[j] = std::min(limit.effort, torque > 0.0f ? torque : limit.effort);
+        }
+    }
+
+    size_t size() const { return effort_.size(); }
+    uint64_t ticks() const { return ticks_; }
+
+    JointSafetyCounters counters(size_t joint) const {
+        JointSafetyCounters c;
+        c.position = positionCount_[joint];
+        c.velocity = velocityCount_[joint];
+        c.torque = torqueCount_[joint];
+        return c;
+    }
+
+    void resetCounters() {
+        std::fill(positionCount_.begin(), positionCount_.end(), 0);
+        std::fill(velocityCount_.begin(), velocityCount_.end(), 0);
+        std::fill(torqueCount_.begin(), torqueCount_.end(), 0);
+        ticks_ = 0;
+    }
+
+    /**
+     * @brief Clamps @p cmd in place for the measured joint positions @p q and velocities @p dq.
+     */
+    void apply(const float* q, const float* dq, RobotCmd& cmd) {
+        const size_t n = std::min(effort_.size(), cmd.q.size());
+        float* qt = cmd.q.data();
+        float* dqt = cmd.dq.data();
+        float* tau = cmd.tau.data();
+        const float* kp = cmd.Kp.data();
+        const float* kd = cmd.Kd.data();
+        const float* lower = lower_.data();
+        const float* upper = upper_.data();
+        const float* velocity = velocity_.data();
+        const float* effortLimit = effort_.data();
+        uint64_t* positionCount = positionCount_.data();
+        uint64_t* velocityCount = velocityCount_.data();
+        uint64_t* torqueCount = torqueCount_.data();
+        LIMX_JOINT_LOOP
+        for (size_t j = 0; j < n; ++j) {
+            const float effort = effortLimit[j];
+            const float position = clip(qt[j], lower[j], upper[j]);
+            const float velocityTarget = clip(dqt[j], -velocity[j], velocity[j]);
+            const float feedForward = clip(tau[j], -effort, effort);
+
+            // Targets that keep the PD torque within +-effort; Kp = 0 bounds the velocity target instead.
+            // Both bounds are computed for every joint and blended by 0/1 masks: selects and divisions
+            // by a selected gain would stop the compiler from vectorizing the loop.
+            const float stiff = static_cast<float>(kp[j] > 0.0f);
+            const float dampedOnly = (1.0f - stiff) * static_cast<float>(kd[j] > 0.0f);
+            const float invKp = 1.0f / (std::fabs(kp[j]) + MIN_GAIN);
+            const float invKd = 1.0f / (std::fabs(kd[j]) + MIN_GAIN);
+            const float lowTorque = -effort - feedForward;
+            const float highTorque = effort - feedForward;
+            const float damping = kd[j] * (velocityTarget - dq[j]);
+            const float pdPosition = clip(position, q[j] + (lowTorque - damping) * invKp,
+                                          q[j] + (highTorque - damping) * invKp);
+            const float pdVelocity = clip(velocityTarget, dq[j] + lowTorque * invKd, dq[j] + highTorque * invKd);
+            const float newPosition = position + stiff * (pdPosition - position);
+            const float newVelocity = velocityTarget + dampedOnly * (pdVelocity - velocityTarget);
+
+            positionCount[j] += position != qt[j];
+            velocityCount[j] += velocityTarget != dqt[j];
+            torqueCount[j] += (feedForward != tau[j]) | (newPosition != position) | (newVelocity != velocityTarget);
+            qt[j] = newPosition;
+            dqt[j] = newVelocity;
+            tau[j] = feedForward;
+        }
+        ticks_++;
+    }
+
+private:
+    static constexpr float MIN_GAIN = 1e-6f;     // Keeps 1 / gain finite; its error is negligible for real gains
+
+    static float clip(float value, float low, float high) {
+        return std::max(low, std::min(high, value));
+    }
+
+    std::vector<float> lower_;
+    std::vector<float> upper_;
+    std::vector<float> velocity_;
+    std::vector<float> effort_;
+    std::vector<uint64_t> positionCount_;
+    std::vector<uint64_t> velocityCount_;
+    std::vector<uint64_t> torqueCount_;
+    uint64_t ticks_ = 0;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // JOINT_SAFETY_H
@@ -0,0 +1,458 @@
+/**
+ * @file locomotion_controller.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef LOCOMOTION_CONTROLLER_H
+#define LOCOMOTION_CONTROLLER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/rl/policy_config.h"
+#include "limxsdk/rl/async_encoder.h"
+#include "limxsdk/rl/inference_session.h"
+#include "limxsdk/rl/observation_builder.h"
+#include "limxsdk/rl/observation_history.h"
+#include "limxsdk/rl/session_warmup.h"
+#include "limxsdk/trajectory/joint_trajectory.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class LocomotionController
+ * @brief The stand and walk state machine of the Python RL controllers, without I/O or threads.
+ *
+ * update() is called once per control cycle with the latest joint state and
+ * IMU sample and fills the joint command. Every decimation-th walk cycle it
+ * builds the observation, runs the encoder on the observation history and
+ * the policy on [latent, observation, commands]. All buffers are sized in
+ * init(), so update() does not allocate.
+ *
+ * With inference.pipelined_encoder the encoder runs on a helper thread:
+ * the history of step k is encoded while the policy of step k runs, and its
+ * latent feeds the policy of step k + 1. The control thread then only pays
+ * for the policy, at the cost of a latent one policy period old.
+ */
+class LIMX_SDK_API LocomotionController {
+public:
+    enum class Mode { STAND, WALK };
+
+    /**
+     * @brief Takes ownership of the loaded sessions and checks their sizes against @p config.
+     */
+    bool init(const PolicyConfig& config, std::unique_ptr<InferenceSession> encoder,
+              std::unique_ptr<InferenceSession> policy) {
+        asyncEncoder_.stop();
+        config_ = config;
+        encoder_ = std::move(encoder);
+        policy_ = std::move(policy);
+        if (!encoder_ || !policy_) {
+            return false;
+        }
+
+        const int n = config_.jointCount();
+        if (!observations_.configure(config_)) {
+            std::cerr << config_.robotType << ": invalid observation layout" << std::endl;
+            return false;
+        }
+        if (encoder_->outputSize() != static_cast<size_t>(config_.encoderOutputSize)) {
+            std::cerr << config_.encoderPath << ": output size " << encoder_->outputSize()
+                      << " does not match encoder_output_size " << config_.encoderOutputSize << std::endl;
+            return false;
+        }
+        const size_t policyInput = config_.encoderOutputSize + config_.observationsSize + config_.policyCommandsSize();
+        if (policy_->inputSize() != policyInput || policy_->outputSize() != static_cast<size_t>(n)) {
+            std::cerr << config_.policyPath << ": expected " << policyInput << " inputs and " << n
+                      << " outputs, model has " << policy_->inputSize() << " and " << policy_->outputSize()
+                      << std::endl;
+            return false;
+        }
+        // The Python controllers size the history by the encoder input and shift it by one observation
+        const size_t historyValues = static_cast<size_t>(config_.historyLength) * config_.observationsSize;
+        if (encoder_->inputSize() != historyValues) {
+            std::cerr << "Warning: " << config_.encoderPath << " takes " << encoder_->inputSize()
+                      << " inputs but obs_history_length * observations_size is " << historyValues << std::endl;
+        }
+        const size_t obs = static_cast<size_t>(config_.observationsSize);
+        if (encoder_->inputSize() < obs || encoder_->inputSize() % obs != 0) {
+            std::cerr << config_.encoderPath << ": input is not a whole number of observations" << std::endl;
+            return false;
+        }
+
+        history_.configure(encoder_->inputSize() / obs, obs);
+        policyInput_.assign(policyInput, 0.0f);
+        rawActions_.assign(n, 0.0f);
+        actions_.assign(n, 0.0f);
+        lastActions_.assign(n, 0.0f);
+        labOrder_.resize(n);
+        for (int i = 0; i < n; ++i) {
+            labOrder_[i] = (i % 2) * (n / 2) + i / 2;
+        }
+        commands_.assign(config_.commandsSize, 0.0f);
+        if (!planStand()) {
+            return false;
+        }
+        reset();
+        if (config_.pipelinedEncoder) {
+            asyncEncoder_.start(encoder_.get(), config_.encoderCpu);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Runs both networks on synthetic inputs so the first real inference runs at steady-state speed.
+     *
+     * Call after init() and before the control loop. The controller state is
+     * not touched; with a pipelined encoder the helper thread is woken once
+     * as well.
+     */
+    bool warmUp(int iterations, WarmupReport& encoder, WarmupReport& policy) {
+        if (!warmUpSession(*encoder_, iterations, encoder) || !warmUpSession(*policy_, iterations, policy)) {
+            std::cerr << config_.robotType << ": warm-up inference failed" << std::endl;
+            return false;
+        }
+        if (pipelined()) {
+            std::vector<float> input(encoder_->inputSize(), 0.0f);
+            std::vector<float> latent(encoder_->outputSize());
+            asyncEncoder_.submit(input.data());
+            return asyncEncoder_.wait(latent.data());
+        }
+        return true;
+    }
+
+    /**
+     * @brief Restarts from stand mode, as the Python controllers do on every start.
+     */
+    void reset() {
+        mode_ = Mode::STAND;
+        loopCount_ = 0;
+        standStep_ = (config_.family == RobotFamily::WHEELFOOT ? 3.0 : 1.0) /
+                     (config_.standDuration * config_.loopFrequency);
+        standPercent_ = 1.0 / (config_.standDuration * config_.loopFrequency);
+        gaitIndex_ = 0.0f;
+        firstObservation_ = true;
+        std::fill(actions_.begin(), actions_.end(), 0.0f);
+        std::fill(lastActions_.begin(), lastActions_.end(), 0.0f);
+        // A latent from the previous run must not reach the first policy step
+        if (asyncEncoder_.pending()) {
+            asyncEncoder_.wait(nullptr);
+        }
+    }
+
+    /**
+     * @brief Continues walking from the state of @p other, which drives the same joints.
+     *
+     * Used to switch policies without standing up again: stand mode is
+     * skipped, the previous actions and gait clock are carried over, and the
+     * history restarts from the next observation as after reset(). The next
+     * update() runs an inference.
+     */
+    void takeOver(const LocomotionController& other) {
+        reset();
+        mode_ = Mode::WALK;
+        if (observations_.hasGait() && other.observations_.hasGait()) {
+            gaitIndex_ = other.gaitIndex_;
+        }
+        std::copy(other.actions_.begin(), other.actions_.end(), actions_.begin());
+        std::copy(other.lastActions_.begin(), other.lastActions_.end(), lastActions_.begin());
+    }
+
+    /**
+     * @brief Sets the velocity command, each component in [-1, 1] before the user_cmd_scales.
+     */
+    void setCommands(float linearX, float linearY, float angularZ) {
+        commands_[0] = linearX;
+        commands_[1] = linearY;
+        commands_[2] = angularZ;
+    }
+
+    /**
+     * @brief Sizes @p cmd for the configured joints with the stand gains.
+     */
+    void prepareCommand(RobotCmd& cmd) const {
+        const int n = config_.jointCount();
+        cmd.mode.assign(n, 0);
+        cmd.q.assign(n, 0.0f);
+        cmd.dq.assign(n, 0.0f);
+        cmd.tau.assign(n, 0.0f);
+        cmd.Kp.assign(n, config_.stiffness);
+        cmd.Kd.assign(n, config_.damping);
+        cmd.motor_names = config_.jointNames;
+    }
+
+    /**
+     * @brief Damping-only command sent when the controller stops.
+     */
+    static void safeStop(RobotCmd& cmd) {
+        std::fill(cmd.q.begin(), cmd.q.end(), 0.0f);
+        std::fill(cmd.dq.begin(), cmd.dq.end(), 0.0f);
+        std::fill(cmd.tau.begin(), cmd.tau.end(), 0.0f);
+        std::fill(cmd.Kp.begin(), cmd.Kp.end(), 0.0f);
+        std::fill(cmd.Kd.begin(), cmd.Kd.end(), 1.0f);
+    }
+
+    /**
+     * @brief Runs one control cycle.
+     * @param q Joint positions, jointCount() values in params.yaml order.
+     * @param dq Joint velocities, same order.
+     * @param imu Latest IMU sample, quaternion in (w, x, y, z).
+     * @param cmd Command prepared by prepareCommand(); entries not written this cycle keep their value.
+     * @return False if inference failed; @p cmd then holds the previous targets.
+     */
+    bool update(const float* q, const float* dq, const ImuData& imu, RobotCmd& cmd) {
+        bool ok = true;
+        inferred_ = false;
+        if (mode_ == Mode::STAND) {
+            updateStand(cmd);
+        } else {
+            if (loopCount_ % config_.decimation == 0) {
+                const auto start = std::chrono::steady_clock::now();
+                ok = infer(q, dq, imu);
+                inferenceNs_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+                inferred_ = true;
+            }
+            if (ok) {
+                updateWalk(q, dq, cmd);
+            }
+        }
+        loopCount_++;
+        return ok;
+    }
+
+    Mode mode() const { return mode_; }
+
+    /**
+     * @brief True if the next update() runs the networks, i.e. it falls on a decimation boundary.
+     */
+    bool inferenceDue() const { return mode_ == Mode::WALK && loopCount_ % config_.decimation == 0; }
+
+    const PolicyConfig& config() const { return config_; }
+    const std::vector<float>& actions() const { return actions_; }
+
+    /**
+     * @brief Unclipped observation of the last inference, the newest entry of the encoder input.
+     */
+    const float* observation() const { return history_.newest(); }
+
+    /**
+     * @brief Network inputs of the last inference: the observation history and [latent, observation, commands].
+     */
+    const float* encoderInput() const { return history_.view(); }
+    size_t encoderInputSize() const { return history_.slots() * history_.size(); }
+    const std::vector<float>& policyInput() const { return policyInput_; }
+
+    /**
+     * @brief True if the last update() ran the networks; inferenceNs() is the time they took.
+     */
+    bool inferred() const { return inferred_; }
+    int64_t inferenceNs() const { return inferenceNs_; }
+
+    /**
+     * @brief True if the encoder runs pipelined on its helper thread.
+     */
+    bool pipelined() const { return asyncEncoder_.running(); }
+
+    /**
+     * @brief Age of the latent used by the policy in seconds: one policy period when pipelined, else 0.
+     */
+    double latentAge() const { return pipelined() ? config_.decimation / config_.loopFrequency : 0.0; }
+
+    /**
+     * @brief Pipelined only: encoder time moved off the control thread and the part of it still waited for.
+     */
+    int64_t encoderNs() const { return asyncEncoder_.runNs(); }
+    int64_t encoderWaitNs() const { return asyncEncoder_.waitNs(); }
+
+private:
+    void updateStand(RobotCmd& cmd) {
+        if (standPercent_ >= 1.0) {
+            mode_ = Mode::WALK;
+            return;
+        }
+        const float percent = static_cast<float>(standPercent_);
+        if (standTrajectory_.size() > 0) {
+            standTrajectory_.evaluate(standPercent_, standTargets_.data());
+        }
+        for (int j = 0; j < config_.jointCount(); ++j) {
+            if (config_.jointKinds[j] == JointKind::WHEEL) {
+                setJoint(cmd, j, 0.0f, 0.0f, 0.0f, config_.wheelDamping);
+            } else if (standTrajectory_.size() > 0) {
+                setJoint(cmd, j, standTargets_[j], 0.0f, config_.stiffness, config_.damping);
+            } else {
+                setJoint(cmd, j, config_.standJointAngles[j] * percent, 0.0f, config_.stiffness, config_.damping);
+            }
+        }
+        standPercent_ += standStep_;
+    }
+
+    /**
+     * Plans the stand-up in units of the stand progress, from zero to the stand angles over one unit,
+     * so updateStand() samples it at standPercent_. The linear profile keeps the plain blend.
+     */
+    bool planStand() {
+        standTrajectory_ = trajectory::JointTrajectory();
+        if (config_.standProfile == trajectory::Profile::LINEAR) {
+            return true;
+        }
+        const int n = config_.jointCount();
+        trajectory::TrajectoryRequest request;
+        request.profile = config_.standProfile;
+        request.start.assign(n, 0.0f);
+        request.goal.assign(config_.standJointAngles.begin(), config_.standJointAngles.end());
+        for (int j = 0; j < n; ++j) {
+            if (config_.jointKinds[j] == JointKind::WHEEL) {
+                request.goal[j] = 0.0f;
+            }
+        }
+        request.minDuration = 1.0;
+        standTargets_.assign(n, 0.0f);
+        if (!standTrajectory_.plan(request)) {
+            std::cerr << config_.robotType << ": cannot plan the " << config_.standProfileName << " stand-up"
+                      << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool infer(const float* q, const float* dq, const ImuData& imu) {
+        // The pipelined encoder still reads the history; collect the latent of the previous step first
+        if (asyncEncoder_.pending() && !asyncEncoder_.wait(policyInput_.data())) {
+            return false;
+        }
+        if (observations_.hasGait()) {
+            gaitIndex_ += 0.02f * config_.gaitFrequency;
+            if (gaitIndex_ > 1.0f) {
+                gaitIndex_ = 0.0f;
+            }
+        }
+
+        // Build the new observation in place: raw over the oldest history entry,
+        // clipped with the commands after the latent in the policy input
+        ObservationInputs in;
+        in.q = q;
+        in.dq = dq;
+        in.imu = &imu;
+        in.lastActions = lastActions_.data();
+        in.commands = commands_.data();
+        in.gaitPhase = gaitIndex_;
+        observations_.build(in, history_.next(), policyInput_.data() + config_.encoderOutputSize);
+        history_.push();
+        const bool first = firstObservation_;
+        if (firstObservation_) {
+            // The Python controllers seed obs_history_length entries, then shift once
+            history_.seed(static_cast<size_t>(config_.historyLength - 1));
+            firstObservation_ = false;
+        }
+
+        // The latent completes the policy input: [latent, clipped observation, scaled commands].
+        // Pipelined, the first step has no previous latent and encodes inline as well.
+        if ((!pipelined() || first) && !encoder_->run(history_.view(), policyInput_.data())) {
+            return false;
+        }
+        if (pipelined()) {
+            asyncEncoder_.submit(history_.view());
+        }
+        if (!policy_->run(policyInput_.data(), rawActions_.data())) {
+            return false;
+        }
+
+        const int n = config_.jointCount();
+        for (int i = 0; i < n; ++i) {
+            rawActions_[i] = clip(rawActions_[i], -config_.clipActions, config_.clipActions);
+        }
+        if (config_.isaaclab()) {
+            for (int i = 0; i < n; ++i) {
+                actions_[labOrder_[i]] = rawActions_[i];
+            }
+        } else {
+            std::copy(rawActions_.begin(), rawActions_.end(), actions_.begin());
+        }
+        return true;
+    }
+
+    void updateWalk(const float* q, const float* dq, RobotCmd& cmd) {
+        const float scale = config_.actionScale;
+        for (int i = 0; i < config_.jointCount(); ++i) {
+            const JointKind kind = config_.jointKinds[i];
+            if (kind == JointKind::WHEEL) {
+                const float wd = config_.wheelDamping;
+                const float low = (dq[i] - config_.wheelTorqueLimit / wd) / wd;
+                const float high = (dq[i] + config_.wheelTorqueLimit / wd) / wd;
+                lastActions_[i] = actions_[i];
+                actions_[i] = clip(actions_[i], low, high);
+                setJoint(cmd, i, 0.0f, actions_[i] * wd, 0.0f, wd);
+                continue;
+            }
+
+            // Limit the action so the PD torque stays within the configured limit
+            const float kd = kind == JointKind::ANKLE ? config_.ankleDamping : config_.damping;
+            const float limit = kind == JointKind::ANKLE ? config_.ankleTorqueLimit : config_.torqueLimit;
+            const float offset = q[i] - config_.defaultJointAngles[i];
+            const float low = (offset + (kd * dq[i] - limit) / config_.stiffness) / scale;
+            const float high = (offset + (kd * dq[i] + limit) / config_.stiffness) / scale;
+            // Ankles feed back the unclipped action, as in the Python sole-foot controller
+            if (kind == JointKind::ANKLE) {
+                lastActions_[i] = actions_[i];
+            }
+            actions_[i] = clip(actions_[i], low, high);
+            if (kind == JointKind::LEG) {
+                lastActions_[i] = actions_[i];
+            }
+            setJoint(cmd, i, actions_[i] * scale + config_.defaultJointAngles[i], 0.0f, config_.stiffness, kd);
+        }
+    }
+
+    static void setJoint(RobotCmd& cmd, int j, float q, float dq, float kp, float kd) {
+        cmd.q[j] = q;
+        cmd.dq[j] = dq;
+        cmd.tau[j] = 0.0f;
+        cmd.Kp[j] = kp;
+        cmd.Kd[j] = kd;
+    }
+
+    static float clip(float value, float low, float high) {
+        return std::max(low, std::min(high, value));
+    }
+
+    PolicyConfig config_;
+    std::unique_ptr<InferenceSession> encoder_;
+    std::unique_ptr<InferenceSession> policy_;
+
+    Mode mode_ = Mode::STAND;
+    uint64_t loopCount_ = 0;
+    double standPercent_ = 0.0;
+    double standStep_ = 0.0;
+    trajectory::JointTrajectory standTrajectory_;     // Empty for the linear stand-up
+    std::vector<float> standTargets_;
+    float gaitIndex_ = 0.0f;
+    bool firstObservation_ = true;
+    bool inferred_ = false;
+    int64_t inferenceNs_ = 0;
+
+    ObservationBuilder observations_;
+    std::vector<float> commands_;
+    ObservationHistory history_;
+    std::vector<float> policyInput_;
+    std::vector<float> rawActions_;
+    std::vector<float> actions_;
+    std::vector<float> lastActions_;
+    std::vector<int> labOrder_;
+
+    // Declared after encoder_ so the helper thread ends before the session is destroyed
+    AsyncEncoder asyncEncoder_;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // LOCOMOTION_CONTROLLER_H
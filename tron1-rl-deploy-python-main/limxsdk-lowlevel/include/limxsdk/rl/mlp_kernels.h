@@ -0,0 +1,505 @@
+/**
+ * @file mlp_kernels.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef MLP_KERNELS_H
+#define MLP_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LIMX_MLP_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define LIMX_MLP_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class AlignedArray
+ * @brief Array whose first element is aligned to ALIGNMENT bytes.
+ */
+template <typename T>
+class LIMX_SDK_API AlignedArray {
+public:
+    enum { ALIGNMENT = 64 };
+
+    AlignedArray() : data_(nullptr), size_(0) {}
+    AlignedArray(AlignedArray&& other) = default;
+    AlignedArray& operator=(AlignedArray&& other) = default;
+    AlignedArray(const AlignedArray&) = delete;
+    AlignedArray& operator=(const AlignedArray&) = delete;
+
+    /**
+     * @brief Reallocates to @p size zero-initialized elements; 0 releases the memory.
+     */
+    void resize(size_t size) {
+        if (size == 0) {
+            std::vector<T>().swap(storage_);
+            data_ = nullptr;
+            size_ = 0;
+            return;
+        }
+        const size_t extra = ALIGNMENT / sizeof(T);
+        storage_.assign(size + extra, T());
+        const uintptr_t address = reinterpret_cast<uintptr_t>(storage_.data());
+        const uintptr_t aligned = (address + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+        data_ = storage_.data() + (aligned - address) / sizeof(T);
+        size_ = size;
+    }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    size_t size() const { return size_; }
+    T& operator[](size_t i) { return data_[i]; }
+    const T& operator[](size_t i) const { return data_[i]; }
+
+private:
+    std::vector<T> storage_;   // Moving a vector keeps its heap block, so data_ stays valid
+    T* data_;
+    size_t size_;
+};
+
+typedef AlignedArray<float> AlignedBuffer;
+
+namespace mlp_kernels {
+
+/**
+ * Dense layer kernel: y[0, stride) = bias + sum_i x[i] * w[i * stride + (0, stride)].
+ *
+ * Weights are stored input-major with each row padded to stride floats, a
+ * multiple of STRIDE_MULTIPLE, so the kernels stream contiguous aligned rows
+ * and accumulate whole output blocks in registers without horizontal sums.
+ * @p w, @p bias and @p y are AlignedBuffer::ALIGNMENT aligned; @p x is not.
+ */
+typedef void (*GemvFunction)(const float* x, int in, const float* w, int stride, const float* bias, float* y);
+
+/**
+ * Same with IEEE half precision weights, widened to float as they are loaded.
+ */
+typedef void (*GemvHalfFunction)(const float* x, int in, const uint16_t* w, int stride, const float* bias, float* y);
+
+/**
+ * Same with int8 weights quantized per output channel:
+ * y[o] = bias[o] + scale[o] * sum_i x[i] * w[i * stride + o].
+ */
+typedef void (*GemvInt8Function)(const float* x, int in, const int8_t* w, int stride, const float* scale,
+                                 const float* bias, float* y);
+
+enum { STRIDE_MULTIPLE = 16 };
+
+struct LIMX_SDK_API Kernel {
+    const char* name;
+    GemvFunction gemv;
+    GemvHalfFunction gemvHalf;
+    GemvInt8Function gemvInt8;
+};
+
+/**
+ * @brief Rounds @p value to the nearest half precision number (ties to even).
+ */
+inline uint16_t floatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    const int exponent = static_cast<int>((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFF;
+    if (((bits >> 23) & 0xFF) == 0xFF) {
+        return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+    }
+    if (exponent >= 31) {
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+    int shift = 13;
+    uint32_t half;
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return sign;
+        }
+        mantissa |= 0x800000;   // Subnormal: shift the implicit one in
+        shift = 14 - exponent;
+        half = mantissa >> shift;
+    } else {
+        half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> shift);
+    }
+    const uint32_t rest = mantissa & ((1u << shift) - 1);
+    const uint32_t midpoint = 1u << (shift - 1);
+    if (rest > midpoint || (rest == midpoint && (half & 1))) {
+        ++half;   // A carry into the exponent is still the correctly rounded value
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+inline float halfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    int exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+    uint32_t bits;
+    if (exponent == 0x1F) {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else if (exponent != 0) {
+        bits = sign | (static_cast<uint32_t>(exponent + 112) << 23) | (mantissa << 13);
+    } else if (mantissa == 0) {
+        bits = sign;
+    } else {
+        exponent = 1;
+        while (!(mantissa & 0x400)) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        bits = sign | (static_cast<uint32_t>(exponent + 112) << 23) | ((mantissa & 0x3FF) << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline void gemvScalar(const float* x, int in, const float* w, int stride, const float* bias, float* y) {
+    for (int o = 0; o < stride; ++o) {
+        y[o] = bias[o];
+    }
+    for (int i = 0; i < in; ++i) {
+        const float xi = x[i];
+        const float* row = w + static_cast<size_t>(i) * stride;
+        for (int o = 0; o < stride; ++o) {
+            y[o] += xi * row[o];
+        }
+    }
+}
+
+inline void gemvHalfScalar(const float* x, int in, const uint16_t* w, int stride, const float* bias, float* y) {
+    for (int o = 0; o < stride; ++o) {
+        y[o] = bias[o];
+    }
+    for (int i = 0; i < in; ++i) {
+        const float xi = x[i];
+        const uint16_t* row = w + static_cast<size_t>(i) * stride;
+        for (int o = 0; o < stride; ++o) {
+            y[o] += xi * halfToFloat(row[o]);
+        }
+    }
+}
+
+inline void gemvInt8Scalar(const float* x, int in, const int8_t* w, int stride, const float* scale, const float* bias,
+                           float* y) {
+    for (int o = 0; o < stride; ++o) {
+        y[o] = 0.0f;
+    }
+    for (int i = 0; i < in; ++i) {
+        const float xi = x[i];
+        const int8_t* row = w + static_cast<size_t>(i) * stride;
+        for (int o = 0; o < stride; ++o) {
+            y[o] += xi * static_cast<float>(row[o]);
+        }
+    }
+    for (int o = 0; o < stride; ++o) {
+        y[o] = bias[o] + scale[o] * y[o];
+    }
+}
+
+#ifdef LIMX_MLP_X86
+__attribute__((target("avx2,fma"))) inline void gemvAvx2(const float* x, int in, const float* w, int stride,
+                                                        const float* bias, float* y) {
+    int o = 0;
+    for (; o + 32 <= stride; o += 32) {
+        __m256 a0 = _mm256_load_ps(bias + o);
+        __m256 a1 = _mm256_load_ps(bias + o + 8);
+        __m256 a2 = _mm256_load_ps(bias + o + 16);
+        __m256 a3 = _mm256_load_ps(bias + o + 24);
+        const float* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m256 xi = _mm256_set1_ps(x[i]);
+            a0 = _mm256_fmadd_ps(xi, _mm256_load_ps(row), a0);
+            a1 = _mm256_fmadd_ps(xi, _mm256_load_ps(row + 8), a1);
+            a2 = _mm256_fmadd_ps(xi, _mm256_load_ps(row + 16), a2);
+            a3 = _mm256_fmadd_ps(xi, _mm256_load_ps(row + 24), a3);
+        }
+        _mm256_store_ps(y + o, a0);
+        _mm256_store_ps(y + o + 8, a1);
+        _mm256_store_ps(y + o + 16, a2);
+        _mm256_store_ps(y + o + 24, a3);
+    }
+    for (; o < stride; o += 16) {
+        __m256 a0 = _mm256_load_ps(bias + o);
+        __m256 a1 = _mm256_load_ps(bias + o + 8);
+        const float* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m256 xi = _mm256_set1_ps(x[i]);
+            a0 = _mm256_fmadd_ps(xi, _mm256_load_ps(row), a0);
+            a1 = _mm256_fmadd_ps(xi, _mm256_load_ps(row + 8), a1);
+        }
+        _mm256_store_ps(y + o, a0);
+        _mm256_store_ps(y + o + 8, a1);
+    }
+}
+
+__attribute__((target("avx2,fma,f16c"))) inline void gemvHalfAvx2(const float* x, int in, const uint16_t* w,
+                                                                 int stride, const float* bias, float* y) {
+    for (int o = 0; o < stride; o += 16) {
+        __m256 a0 = _mm256_load_ps(bias + o);
+        __m256 a1 = _mm256_load_ps(bias + o + 8);
+        const uint16_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m256 xi = _mm256_set1_ps(x[i]);
+            a0 = _mm256_fmadd_ps(xi, _mm256_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(row))), a0);
+            a1 = _mm256_fmadd_ps(xi, _mm256_cvtph_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(row + 8))), a1);
+        }
+        _mm256_store_ps(y + o, a0);
+        _mm256_store_ps(y + o + 8, a1);
+    }
+}
+
+__attribute__((target("avx2,fma"))) inline void gemvInt8Avx2(const float* x, int in, const int8_t* w, int stride,
+                                                            const float* scale, const float* bias, float* y) {
+    for (int o = 0; o < stride; o += 16) {
+        __m256 a0 = _mm256_setzero_ps();
+        __m256 a1 = _mm256_setzero_ps();
+        const int8_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m256 xi = _mm256_set1_ps(x[i]);
+            const __m128i q = _mm_load_si128(reinterpret_cast<const __m128i*>(row));
+            a0 = _mm256_fmadd_ps(xi, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(q)), a0);
+            a1 = _mm256_fmadd_ps(xi, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(q, 8))), a1);
+        }
+        _mm256_store_ps(y + o, _mm256_fmadd_ps(a0, _mm256_load_ps(scale + o), _mm256_load_ps(bias + o)));
+        _mm256_store_ps(y + o + 8, _mm256_fmadd_ps(a1, _mm256_load_ps(scale + o + 8), _mm256_load_ps(bias + o + 8)));
+    }
+}
+
+__attribute__((target("avx512f"))) inline void gemvAvx512(const float* x, int in, const float* w, int stride,
+                                                         const float* bias, float* y) {
+    int o = 0;
+    for (; o + 64 <= stride; o += 64) {
+        __m512 a0 = _mm512_load_ps(bias + o);
+        __m512 a1 = _mm512_load_ps(bias + o + 16);
+        __m512 a2 = _mm512_load_ps(bias + o + 32);
+        __m512 a3 = _mm512_load_ps(bias + o + 48);
+        const float* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m512 xi = _mm512_set1_ps(x[i]);
+            a0 = _mm512_fmadd_ps(xi, _mm512_load_ps(row), a0);
+            a1 = _mm512_fmadd_ps(xi, _mm512_load_ps(row + 16), a1);
+            a2 = _mm512_fmadd_ps(xi, _mm512_load_ps(row + 32), a2);
+            a3 = _mm512_fmadd_ps(xi, _mm512_load_ps(row + 48), a3);
+        }
+        _mm512_store_ps(y + o, a0);
+        _mm512_store_ps(y + o + 16, a1);
+        _mm512_store_ps(y + o + 32, a2);
+        _mm512_store_ps(y + o + 48, a3);
+    }
+    for (; o < stride; o += 16) {
+        __m512 a0 = _mm512_load_ps(bias + o);
+        const float* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            a0 = _mm512_fmadd_ps(_mm512_set1_ps(x[i]), _mm512_load_ps(row), a0);
+        }
+        _mm512_store_ps(y + o, a0);
+    }
+}
+
+// The all-ones maskz forms avoid GCC's uninitialized pass-through operand warnings
+__attribute__((target("avx512f"))) inline __m512 halfToFloatAvx512(const uint16_t* h) {
+    return _mm512_maskz_cvtph_ps(0xFFFF, _mm256_load_si256(reinterpret_cast<const __m256i*>(h)));
+}
+
+__attribute__((target("avx512f"))) inline __m512 int8ToFloatAvx512(__m128i q) {
+    return _mm512_maskz_cvtepi32_ps(0xFFFF, _mm512_maskz_cvtepi8_epi32(0xFFFF, q));
+}
+
+__attribute__((target("avx512f"))) inline void gemvHalfAvx512(const float* x, int in, const uint16_t* w, int stride,
+                                                             const float* bias, float* y) {
+    int o = 0;
+    for (; o + 32 <= stride; o += 32) {
+        __m512 a0 = _mm512_load_ps(bias + o);
+        __m512 a1 = _mm512_load_ps(bias + o + 16);
+        const uint16_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m512 xi = _mm512_set1_ps(x[i]);
+            a0 = _mm512_fmadd_ps(xi, halfToFloatAvx512(row), a0);
+            a1 = _mm512_fmadd_ps(xi, halfToFloatAvx512(row + 16), a1);
+        }
+        _mm512_store_ps(y + o, a0);
+        _mm512_store_ps(y + o + 16, a1);
+    }
+    for (; o < stride; o += 16) {
+        __m512 a0 = _mm512_load_ps(bias + o);
+        const uint16_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            a0 = _mm512_fmadd_ps(_mm512_set1_ps(x[i]), halfToFloatAvx512(row), a0);
+        }
+        _mm512_store_ps(y + o, a0);
+    }
+}
+
+__attribute__((target("avx512f"))) inline void gemvInt8Avx512(const float* x, int in, const int8_t* w, int stride,
+                                                             const float* scale, const float* bias, float* y) {
+    int o = 0;
+    for (; o + 32 <= stride; o += 32) {
+        __m512 a0 = _mm512_setzero_ps();
+        __m512 a1 = _mm512_setzero_ps();
+        const int8_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m512 xi = _mm512_set1_ps(x[i]);
+            const __m128i q0 = _mm_load_si128(reinterpret_cast<const __m128i*>(row));
+            const __m128i q1 = _mm_load_si128(reinterpret_cast<const __m128i*>(row + 16));
+            a0 = _mm512_fmadd_ps(xi, int8ToFloatAvx512(q0), a0);
+            a1 = _mm512_fmadd_ps(xi, int8ToFloatAvx512(q1), a1);
+        }
+        _mm512_store_ps(y + o, _mm512_fmadd_ps(a0, _mm512_load_ps(scale + o), _mm512_load_ps(bias + o)));
+        _mm512_store_ps(y + o + 16, _mm512_fmadd_ps(a1, _mm512_load_ps(scale + o + 16), _mm512_load_ps(bias + o + 16)));
+    }
+    for (; o < stride; o += 16) {
+        __m512 a0 = _mm512_setzero_ps();
+        const int8_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const __m128i q = _mm_load_si128(reinterpret_cast<const __m128i*>(row));
+            a0 = _mm512_fmadd_ps(_mm512_set1_ps(x[i]), int8ToFloatAvx512(q), a0);
+        }
+        _mm512_store_ps(y + o, _mm512_fmadd_ps(a0, _mm512_load_ps(scale + o), _mm512_load_ps(bias + o)));
+    }
+}
+#endif // LIMX_MLP_X86
+
+#ifdef LIMX_MLP_NEON
+inline float32x4_t neonFma(float32x4_t acc, float32x4_t a, float32x4_t b) {
+#if defined(__aarch64__)
+    return vfmaq_f32(acc, a, b);
+#else
+    return vmlaq_f32(acc, a, b);
+#endif
+}
+
+inline void gemvNeon(const float* x, int in, const float* w, int stride, const float* bias, float* y) {
+    for (int o = 0; o < stride; o += 16) {
+        float32x4_t a0 = vld1q_f32(bias + o);
+        float32x4_t a1 = vld1q_f32(bias + o + 4);
+        float32x4_t a2 = vld1q_f32(bias + o + 8);
+        float32x4_t a3 = vld1q_f32(bias + o + 12);
+        const float* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const float32x4_t xi = vdupq_n_f32(x[i]);
+            a0 = neonFma(a0, xi, vld1q_f32(row));
+            a1 = neonFma(a1, xi, vld1q_f32(row + 4));
+            a2 = neonFma(a2, xi, vld1q_f32(row + 8));
+            a3 = neonFma(a3, xi, vld1q_f32(row + 12));
+        }
+        vst1q_f32(y + o, a0);
+        vst1q_f32(y + o + 4, a1);
+        vst1q_f32(y + o + 8, a2);
+        vst1q_f32(y + o + 12, a3);
+    }
+}
+
+#if defined(__aarch64__)
+inline void gemvHalfNeon(const float* x, int in, const uint16_t* w, int stride, const float* bias, float* y) {
+    for (int o = 0; o < stride; o += 16) {
+        float32x4_t a0 = vld1q_f32(bias + o);
+        float32x4_t a1 = vld1q_f32(bias + o + 4);
+        float32x4_t a2 = vld1q_f32(bias + o + 8);
+        float32x4_t a3 = vld1q_f32(bias + o + 12);
+        const uint16_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const float32x4_t xi = vdupq_n_f32(x[i]);
+            const float16x8_t h0 = vreinterpretq_f16_u16(vld1q_u16(row));
+            const float16x8_t h1 = vreinterpretq_f16_u16(vld1q_u16(row + 8));
+            a0 = vfmaq_f32(a0, xi, vcvt_f32_f16(vget_low_f16(h0)));
+            a1 = vfmaq_f32(a1, xi, vcvt_high_f32_f16(h0));
+            a2 = vfmaq_f32(a2, xi, vcvt_f32_f16(vget_low_f16(h1)));
+            a3 = vfmaq_f32(a3, xi, vcvt_high_f32_f16(h1));
+        }
+        vst1q_f32(y + o, a0);
+        vst1q_f32(y + o + 4, a1);
+        vst1q_f32(y + o + 8, a2);
+        vst1q_f32(y + o + 12, a3);
+    }
+}
+#endif
+
+inline void gemvInt8Neon(const float* x, int in, const int8_t* w, int stride, const float* scale, const float* bias,
+                         float* y) {
+    for (int o = 0; o < stride; o += 16) {
+        float32x4_t a0 = vdupq_n_f32(0.0f);
+        float32x4_t a1 = vdupq_n_f32(0.0f);
+        float32x4_t a2 = vdupq_n_f32(0.0f);
+        float32x4_t a3 = vdupq_n_f32(0.0f);
+        const int8_t* row = w + o;
+        for (int i = 0; i < in; ++i, row += stride) {
+            const float32x4_t xi = vdupq_n_f32(x[i]);
+            const int8x16_t q = vld1q_s8(row);
+            const int16x8_t low = vmovl_s8(vget_low_s8(q));
+            const int16x8_t high = vmovl_s8(vget_high_s8(q));
+            a0 = neonFma(a0, xi, vcvtq_f32_s32(vmovl_s16(vget_low_s16(low))));
+            a1 = neonFma(a1, xi, vcvtq_f32_s32(vmovl_s16(vget_high_s16(low))));
+            a2 = neonFma(a2, xi, vcvtq_f32_s32(vmovl_s16(vget_low_s16(high))));
+            a3 = neonFma(a3, xi, vcvtq_f32_s32(vmovl_s16(vget_high_s16(high))));
+        }
+        vst1q_f32(y + o, neonFma(vld1q_f32(bias + o), a0, vld1q_f32(scale + o)));
+        vst1q_f32(y + o + 4, neonFma(vld1q_f32(bias + o + 4), a1, vld1q_f32(scale + o + 4)));
+        vst1q_f32(y + o + 8, neonFma(vld1q_f32(bias + o + 8), a2, vld1q_f32(scale + o + 8)));
+        vst1q_f32(y + o + 12, neonFma(vld1q_f32(bias + o + 12), a3, vld1q_f32(scale + o + 12)));
+    }
+}
+#endif // LIMX_MLP_NEON
+
+/**
+ * @brief Kernels usable on this CPU, fastest first. The scalar kernel is always last.
+ */
+inline std::vector<Kernel> available() {
+    std::vector<Kernel> kernels;
+#ifdef LIMX_MLP_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        kernels.push_back(Kernel{"avx512", &gemvAvx512, &gemvHalfAvx512, &gemvInt8Avx512});
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("f16c")) {
+        kernels.push_back(Kernel{"avx2", &gemvAvx2, &gemvHalfAvx2, &gemvInt8Avx2});
+    }
+#endif
+#ifdef LIMX_MLP_NEON
+#if defined(__aarch64__)
+    kernels.push_back(Kernel{"neon", &gemvNeon, &gemvHalfNeon, &gemvInt8Neon});
+#else
+    // ARMv7 NEON has no portable half precision conversion
+    kernels.push_back(Kernel{"neon", &gemvNeon, &gemvHalfScalar, &gemvInt8Neon});
+#endif
+#endif
+    kernels.push_back(Kernel{"scalar", &gemvScalar, &gemvHalfScalar, &gemvInt8Scalar});
+    return kernels;
+}
+
+/**
+ * @brief True for the name of any kernel of this engine, whether or not it is available on this CPU.
+ */
+inline bool isKernelName(const std::string& name) {
+    return name == "avx512" || name == "avx2" || name == "neon" || name == "scalar";
+}
+
+/**
+ * @brief Returns the kernel named @p name, or the fastest available one if @p name is empty or unavailable.
+ */
+inline Kernel select(const std::string& name = "") {
+    const std::vector<Kernel> kernels = available();
+    for (const auto& kernel : kernels) {
+        if (name == kernel.name) {
+            return kernel;
+        }
+    }
+    return kernels.front();
+}
+
+} // namespace mlp_kernels
+} // namespace rl
+} // namespace limxsdk
+
+#endif // MLP_KERNELS_H
@@ -0,0 +1,419 @@
+/**
+ * @file mlp_session.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef MLP_SESSION_H
+#define MLP_SESSION_H
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/inference_session.h"
+#include "limxsdk/rl/mlp_kernels.h"
+#include "limxsdk/rl/onnx_model.h"
+
+namespace limxsdk {
+namespace rl {
+
+enum class Activation { NONE, ELU, RELU, TANH };
+
+/**
+ * @brief Storage of the dense layer weights; activations and biases stay float.
+ */
+enum class Precision {
+    FP32,
+    FP16,   // IEEE half
+    INT8    // Symmetric, one scale per output channel
+};
+
+inline const char* precisionName(Precision precision) {
+    return precision == Precision::FP16 ? "fp16" : precision == Precision::INT8 ? "int8" : "fp32";
+}
+
+/**
+ * @brief Parses "fp32", "fp16" or "int8"; returns false for anything else.
+ */
+inline bool parsePrecision(const std::string& name, Precision& precision) {
+    if (name == "fp32") {
+        precision = Precision::FP32;
+    } else if (name == "fp16") {
+        precision = Precision::FP16;
+    } else if (name == "int8") {
+        precision = Precision::INT8;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @struct DenseLayer
+ * @brief Packed weights of one fully connected layer and its activation.
+ */
+struct LIMX_SDK_API DenseLayer {
+    int in = 0;
+    int out = 0;
+    int stride = 0;               // out rounded up to mlp_kernels::STRIDE_MULTIPLE
+    Activation activation = Activation::NONE;
+    float alpha = 1.0f;           // ELU alpha
+    AlignedBuffer bias;           // stride
+    Precision precision = Precision::FP32;
+    // in x stride, input-major; only the array of the layer precision is allocated
+    AlignedBuffer weights;
+    AlignedArray<uint16_t> halfWeights;
+    AlignedArray<int8_t> int8Weights;
+    AlignedBuffer scales;         // stride, INT8 only
+};
+
+/**
+ * @class MlpNetwork
+ * @brief Feed-forward network imported from an ONNX MatMul/Gemm + Add + activation chain.
+ *
+ * import() follows the graph from its input to its output and folds each
+ * MatMul or Gemm with the following bias Add into one DenseLayer. The
+ * supported activations are Elu, Relu and Tanh; any other operator on the
+ * path makes the import fail with its name. run() uses two preallocated
+ * ping-pong buffers and does not allocate.
+ */
+class LIMX_SDK_API MlpNetwork {
+public:
+    bool import(const OnnxModel& model, const std::string& kernel = "") {
+        layers_.clear();
+        if (model.inputs().size() != 1 || model.outputs().size() != 1) {
+            std::cerr << "MLP import: expected one graph input and one output" << std::endl;
+            return false;
+        }
+        std::string tensor = model.inputs().front();
+        const std::vector<OnnxNode>& nodes = model.nodes();
+        std::vector<bool> used(nodes.size(), false);
+
+        while (tensor != model.outputs().front()) {
+            size_t k = 0;
+            while (k < nodes.size() && (used[k] || !consumes(nodes[k], tensor))) {
+                ++k;
+            }
+            if (k == nodes.size()) {
+                std::cerr << "MLP import: nothing consumes " << tensor << std::endl;
+                return false;
+            }
+            used[k] = true;
+            const OnnxNode& node = nodes[k];
+            if (!apply(model, node, tensor)) {
+                return false;
+            }
+            tensor = node.outputs.front();
+        }
+        if (layers_.empty()) {
+            std::cerr << "MLP import: graph has no dense layer" << std::endl;
+            return false;
+        }
+
+        size_t widest = layers_.front().in;
+        for (const auto& layer : layers_) {
+            widest = std::max(widest, static_cast<size_t>(layer.stride));
+        }
+        buffers_[0].resize(widest);
+        buffers_[1].resize(widest);
+        kernel_ = mlp_kernels::select(kernel);
+        return true;
+    }
+
+    /**
+     * @brief Converts the fp32 weights of every layer to @p precision and releases the fp32 copy.
+     *
+     * INT8 uses one scale per output channel, max|w| / 127 over that
+     * channel's inputs, so each column keeps its own dynamic range.
+     */
+    void quantize(Precision precision) {
+        for (auto& layer : layers_) {
+            if (layer.precision != Precision::FP32 || precision == Precision::FP32) {
+                continue;
+            }
+            const size_t count = static_cast<size_t>(layer.in) * layer.stride;
+            if (precision == Precision::FP16) {
+                layer.halfWeights.resize(count);
+                for (size_t k = 0; k < count; ++k) {
+                    layer.halfWeights[k] = mlp_kernels::floatToHalf(layer.weights[k]);
+                }
+            } else {
+                layer.int8Weights.resize(count);
+                layer.scales.resize(layer.stride);
+                for (int o = 0; o < layer.out; ++o) {
+                    float peak = 0.0f;
+                    for (int i = 0; i < layer.in; ++i) {
+                        peak = std::max(peak, std::fabs(layer.weights[static_cast<size_t>(i) * layer.stride + o]));
+                    }
+                    const float scale = peak > 0.0f ? peak / 127.0f : 1.0f;
+                    layer.scales[o] = scale;
+                    for (int i = 0; i < layer.in; ++i) {
+                        const size_t k = static_cast<size_t>(i) * layer.stride + o;
+                        const float q = std::round(layer.weights[k] / scale);
+                        layer.int8Weights[k] = static_cast<int8_t>(std::max(-127.0f, std::min(127.0f, q)));
+                    }
+                }
+            }
+            layer.weights.resize(0);
+            layer.precision = precision;
+        }
+    }
+
+    /**
+     * @brief Bytes of weight storage streamed by one run().
+     */
+    size_t weightBytes() const {
+        size_t bytes = 0;
+        for (const auto& layer : layers_) {
+            const size_t count = static_cast<size_t>(layer.in) * layer.stride;
+            bytes += layer.precision == Precision::FP16 ? count * 2 : layer.precision == Precision::INT8 ? count : count * 4;
+        }
+        return bytes;
+    }
+
+    /**
+     * @brief Evaluates the network; @p input holds inputSize() and @p output receives outputSize() floats.
+     */
+    void run(const float* input, float* output) {
+        runLayers(0, input, output);
+    }
+
+    /**
+     * @brief Finishes run() from the first layer's output before its activation, as BatchedMlp computes it.
+     * @param preactivation layers().front().out values; the activation is applied in place.
+     */
+    void runFromFirstLayer(float* preactivation, float* output) {
+        activate(layers_.front(), preactivation);
+        if (layers_.size() == 1) {
+            std::copy(preactivation, preactivation + layers_.front().out, output);
+            return;
+        }
+        runLayers(1, preactivation, output);
+    }
+
+    size_t inputSize() const { return layers_.empty() ? 0 : layers_.front().in; }
+    size_t outputSize() const { return layers_.empty() ? 0 : layers_.back().out; }
+    const std::vector<DenseLayer>& layers() const { return layers_; }
+    const char* kernelName() const { return kernel_.name; }
+
+private:
+    void runLayers(size_t first, const float* input, float* output) {
+        const float* x = input;
+        int current = 0;
+        for (size_t l = first; l < layers_.size(); ++l) {
+            const DenseLayer& layer = layers_[l];
+            float* y = buffers_[current].data();
+            switch (layer.precision) {
+            case Precision::FP16:
+                kernel_.gemvHalf(x, layer.in, layer.halfWeights.data(), layer.stride, layer.bias.data(), y);
+                break;
+            case Precision::INT8:
+                kernel_.gemvInt8(x, layer.in, layer.int8Weights.data(), layer.stride, layer.scales.data(),
+                                 layer.bias.data(), y);
+                break;
+            default:
+                kernel_.gemv(x, layer.in, layer.weights.data(), layer.stride, layer.bias.data(), y);
+                break;
+            }
+            activate(layer, y);
+            x = y;
+            current ^= 1;
+        }
+        std::copy(x, x + layers_.back().out, output);
+    }
+
+    static bool consumes(const OnnxNode& node, const std::string& tensor) {
+        return !node.inputs.empty() && !node.outputs.empty() &&
+               std::find(node.inputs.begin(), node.inputs.end(), tensor) != node.inputs.end();
+    }
+
+    // Returns the other input of a binary node if it is an initializer
+    static const OnnxTensor* constantOperand(const OnnxModel& model, const OnnxNode& node, const std::string& tensor) {
+        for (const auto& name : node.inputs) {
+            if (name != tensor) {
+                return model.initializer(name);
+            }
+        }
+        return nullptr;
+    }
+
+    bool apply(const OnnxModel& model, const OnnxNode& node, const std::string& tensor) {
+        const std::string& op = node.opType;
+        if (op == "MatMul") {
+            const OnnxTensor* w = node.inputs.size() == 2 && node.inputs[0] == tensor ? model.initializer(node.inputs[1])
+                                                                                     : nullptr;
+            if (!w || w->dims.size() != 2) {
+                return unsupported(node, "expects a constant 2-D right operand");
+            }
+            return addLayer(*w, false, 1.0f, nullptr, 0.0f);
+        }
+        if (op == "Gemm") {
+            const OnnxTensor* w = node.inputs.size() >= 2 ? model.initializer(node.inputs[1]) : nullptr;
+            const OnnxTensor* c = node.inputs.size() >= 3 ? model.initializer(node.inputs[2]) : nullptr;
+            if (node.inputs[0] != tensor || !w || w->dims.size() != 2 || intAttribute(node, "transA", 0) != 0) {
+                return unsupported(node, "expects A as input and a constant 2-D B");
+            }
+            return addLayer(*w, intAttribute(node, "transB", 0) != 0, floatAttribute(node, "alpha", 1.0f), c,
+                            floatAttribute(node, "beta", 1.0f));
+        }
+        if (op == "Add") {
+            const OnnxTensor* b = constantOperand(model, node, tensor);
+            if (layers_.empty() || !b || layers_.back().activation != Activation::NONE ||
+                static_cast<int>(b->data.size()) != layers_.back().out) {
+                return unsupported(node, "expects a bias vector after a dense layer");
+            }
+            for (int o = 0; o < layers_.back().out; ++o) {
+                layers_.back().bias[o] += b->data[o];
+            }
+            return true;
+        }
+        if (op == "Elu" || op == "Relu" || op == "Tanh") {
+            if (layers_.empty() || layers_.back().activation != Activation::NONE) {
+                return unsupported(node, "expects a preceding dense layer");
+            }
+            layers_.back().activation = op == "Elu" ? Activation::ELU : op == "Relu" ? Activation::RELU : Activation::TANH;
+            layers_.back().alpha = floatAttribute(node, "alpha", 1.0f);
+            return true;
+        }
+        if (op == "Identity") {
+            return true;
+        }
+        return unsupported(node, "is not supported");
+    }
+
+    bool addLayer(const OnnxTensor& w, bool transposed, float alpha, const OnnxTensor* c, float beta) {
+        const int64_t limit = std::numeric_limits<int>::max();
+        if (w.dims[0] <= 0 || w.dims[1] <= 0 || w.dims[0] > limit || w.dims[1] > limit ||
+            w.data.size() != static_cast<uint64_t>(w.dims[0]) * static_cast<uint64_t>(w.dims[1])) {
+            std::cerr << "MLP import: weight matrix does not hold " << w.dims[0] << " x " << w.dims[1] << " values"
+                      << std::endl;
+            return false;
+        }
+        DenseLayer layer;
+        layer.in = static_cast<int>(transposed ? w.dims[1] : w.dims[0]);
+        layer.out = static_cast<int>(transposed ? w.dims[0] : w.dims[1]);
+        if (!layers_.empty() && layers_.back().out != layer.in) {
+            std::cerr << "MLP import: layer input " << layer.in << " does not match previous output "
+                      << layers_.back().out << std::endl;
+            return false;
+        }
+        const int multiple = mlp_kernels::STRIDE_MULTIPLE;
+        layer.stride = (layer.out + multiple - 1) / multiple * multiple;
+        layer.weights.resize(static_cast<size_t>(layer.in) * layer.stride);
+        layer.bias.resize(layer.stride);
+        for (int i = 0; i < layer.in; ++i) {
+            for (int o = 0; o < layer.out; ++o) {
+                const float value = transposed ? w.data[static_cast<size_t>(o) * layer.in + i]
+                                               : w.data[static_cast<size_t>(i) * layer.out + o];
+                layer.weights[static_cast<size_t>(i) * layer.stride + o] = alpha * value;
+            }
+        }
+        if (c) {
+            if (static_cast<int>(c->data.size()) != layer.out) {
+                std::cerr << "MLP import: Gemm bias must have one value per output" << std::endl;
+                return false;
+            }
+            for (int o = 0; o < layer.out; ++o) {
+                layer.bias[o] = beta * c->data[o];
+            }
+        }
+        layers_.push_back(std::move(layer));
+        return true;
+    }
+
+    static void activate(const DenseLayer& layer, float* y) {
+        switch (layer.activation) {
+        case Activation::ELU:
+            for (int o = 0; o < layer.out; ++o) {
+                y[o] = y[o] > 0.0f ? y[o] : layer.alpha * std::expm1(y[o]);
+            }
+            break;
+        case Activation::RELU:
+            for (int o = 0; o < layer.out; ++o) {
+                y[o] = y[o] > 0.0f ? y[o] : 0.0f;
+            }
+            break;
+        case Activation::TANH:
+            for (int o = 0; o < layer.out; ++o) {
+                y[o] = std::tanh(y[o]);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    static float floatAttribute(const OnnxNode& node, const char* name, float fallback) {
+        auto it = node.floatAttributes.find(name);
+        return it == node.floatAttributes.end() ? fallback : it->second;
+    }
+
+    static int64_t intAttribute(const OnnxNode& node, const char* name, int64_t fallback) {
+        auto it = node.intAttributes.find(name);
+        return it == node.intAttributes.end() ? fallback : it->second;
+    }
+
+    static bool unsupported(const OnnxNode& node, const char* reason) {
+        std::cerr << "MLP import: " << node.opType << " node " << reason << std::endl;
+        return false;
+    }
+
+    std::vector<DenseLayer> layers_;
+    AlignedBuffer buffers_[2];
+    mlp_kernels::Kernel kernel_ = mlp_kernels::select("scalar");
+};
+
+/**
+ * @class MlpSession
+ * @brief InferenceSession backend "native": MlpNetwork with the fastest kernel of the CPU.
+ *
+ * In FP32 it agrees with ONNX Runtime within 1e-4 * (1 + |y|) per output
+ * on the bundled models; the differences come from the summation order
+ * only. FP16 and INT8 errors depend on the weights and must be measured
+ * with rl_quantize_calibrate before deployment.
+ */
+class LIMX_SDK_API MlpSession : public InferenceSession {
+public:
+    /**
+     * @param kernel Kernel name from mlp_kernels::available(), empty for the fastest.
+     * @param precision Weight storage.
+     */
+    explicit MlpSession(const std::string& kernel = "", Precision precision = Precision::FP32)
+        : kernelName_(kernel), precision_(precision) {}
+
+    bool load(const std::string& path) override {
+        OnnxModel model;
+        if (!model.load(path) || !network_.import(model, kernelName_)) {
+            std::cerr << "Failed to load " << path << " into the native MLP engine" << std::endl;
+            return false;
+        }
+        network_.quantize(precision_);
+        return true;
+    }
+
+    size_t inputSize() const override { return network_.inputSize(); }
+    size_t outputSize() const override { return network_.outputSize(); }
+
+    bool run(const float* input, float* output) override {
+        network_.run(input, output);
+        return true;
+    }
+
+    const char* backend() const override { return "native"; }
+
+    const MlpNetwork& network() const { return network_; }
+
+private:
+    std::string kernelName_;
+    Precision precision_;
+    MlpNetwork network_;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // MLP_SESSION_H
@@ -0,0 +1,239 @@
+/**
+ * @file observation_builder.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef OBSERVATION_BUILDER_H
+#define OBSERVATION_BUILDER_H
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/rl/policy_config.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @brief Observation terms, named as in params.yaml size.observation_terms.
+ */
+enum class ObservationTerm {
+    ANG_VEL,             // "ang_vel": gyro in the policy frame times obs_scales.ang_vel
+    PROJECTED_GRAVITY,   // "projected_gravity": gravity direction in the policy frame
+    DOF_POS,             // "dof_pos": (q - default) of jointpos_idxs times obs_scales.dof_pos
+    DOF_VEL,             // "dof_vel": dq times obs_scales.dof_vel
+    LAST_ACTIONS,        // "last_actions": actions applied in the previous policy step
+    GAIT                 // "gait": sin/cos of the gait phase, frequency, offset, duration, swing height
+};
+
+/**
+ * @brief Per-step inputs of ObservationBuilder::build().
+ */
+struct LIMX_SDK_API ObservationInputs {
+    const float* q = nullptr;             // jointCount() positions in params.yaml order
+    const float* dq = nullptr;            // jointCount() velocities
+    const ImuData* imu = nullptr;
+    const float* lastActions = nullptr;   // jointCount() values
+    const float* commands = nullptr;      // commands_size values before user_cmd_scales
+    float gaitPhase = 0.0f;               // Gait clock in [0, 1]
+};
+
+/**
+ * @class ObservationBuilder
+ * @brief Observation and command layout of a policy, compiled from its PolicyConfig.
+ *
+ * configure() turns the term list and the normalization, size,
+ * user_cmd_scales and imu_orientation_offset sections into one table of
+ * (source, bias, scale) entries, with the isaaclab left/right joint
+ * interleaving already applied to the sources. build() then walks that
+ * table once and writes each value straight into the encoder history slot
+ * and, clipped, into the policy input, followed by the scaled commands.
+ */
+class LIMX_SDK_API ObservationBuilder {
+public:
+    bool configure(const PolicyConfig& config) {
+        entries_.clear();
+        hasGait_ = false;
+        clip_ = config.clipObservations;
+        angVelScale_ = config.angVelScale;
+        gaitFrequency_ = config.gaitFrequency;
+        gaitSwingHeight_ = config.gaitSwingHeight;
+        commandsSize_ = config.policyCommandsSize();
+        for (int i = 0; i < 3; ++i) {
+            commandScales_[i] = config.userCmdScales[i];
+        }
+        offsetRotation(config.imuOrientationOffset, offset_);
+
+        const int n = config.jointCount();
+        for (const auto& name : config.observationTerms) {
+            if (name == "ang_vel") {
+                addImu(ObservationTerm::ANG_VEL);
+            } else if (name == "projected_gravity") {
+                addImu(ObservationTerm::PROJECTED_GRAVITY);
+            } else if (name == "dof_pos") {
+                const int observed = static_cast<int>(config.jointPosIdxs.size());
+                for (int i = 0; i < observed; ++i) {
+                    const int j = config.jointPosIdxs[jointOrder(config, i, observed)];
+                    entries_.push_back(Entry{ObservationTerm::DOF_POS, j, config.defaultJointAngles[j],
+                                             config.dofPosScale});
+                }
+            } else if (name == "dof_vel") {
+                for (int i = 0; i < n; ++i) {
+                    entries_.push_back(Entry{ObservationTerm::DOF_VEL, jointOrder(config, i, n), 0.0f,
+                                             config.dofVelScale});
+                }
+            } else if (name == "last_actions") {
+                for (int i = 0; i < n; ++i) {
+                    entries_.push_back(Entry{ObservationTerm::LAST_ACTIONS, jointOrder(config, i, n), 0.0f, 1.0f});
+                }
+            } else if (name == "gait") {
+                for (int i = 0; i < 6; ++i) {
+                    entries_.push_back(Entry{ObservationTerm::GAIT, i, 0.0f, 1.0f});
+                }
+                hasGait_ = true;
+            } else {
+                std::cerr << "Unknown observation term: " << name << std::endl;
+                return false;
+            }
+        }
+        if (static_cast<int>(entries_.size()) != config.observationsSize) {
+            std::cerr << "Observation terms give " << entries_.size() << " values but observations_size is "
+                      << config.observationsSize << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Writes one observation.
+     * @param history size() raw values, e.g. the newest slot of the encoder input. May be null.
+     * @param policy size() clipped values followed by commandsSize() scaled commands. May be null.
+     */
+    void build(const ObservationInputs& in, float* history, float* policy) const {
+        // Frame-dependent IMU terms are computed once and then gathered like joint values
+        float imu[6];
+        rotateImu(*in.imu, imu);
+        const float phase = in.gaitPhase * 6.28318530718f;
+        const float gait[6] = {std::sin(phase), std::cos(phase), gaitFrequency_, 0.5f, 0.5f, gaitSwingHeight_};
+
+        const size_t count = entries_.size();
+        for (size_t k = 0; k < count; ++k) {
+            const Entry& e = entries_[k];
+            float value;
+            switch (e.term) {
+            case ObservationTerm::ANG_VEL:
+            case ObservationTerm::PROJECTED_GRAVITY:
+                value = imu[e.source];
+                break;
+            case ObservationTerm::DOF_POS:
+                value = (in.q[e.source] - e.bias) * e.scale;
+                break;
+            case ObservationTerm::DOF_VEL:
+                value = in.dq[e.source] * e.scale;
+                break;
+            case ObservationTerm::LAST_ACTIONS:
+                value = in.lastActions[e.source];
+                break;
+            default:
+                value = gait[e.source];
+                break;
+            }
+            if (history) {
+                history[k] = value;
+            }
+            if (policy) {
+                policy[k] = value < -clip_ ? -clip_ : (value > clip_ ? clip_ : value);
+            }
+        }
+        if (policy) {
+            float* commands = policy + count;
+            for (int i = 0; i < commandsSize_; ++i) {
+                // Commands past the velocities are gait switches the joystick never sets
+                commands[i] = i < 3 ? in.commands[i] * commandScales_[i] : in.commands[i];
+            }
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+    int commandsSize() const { return commandsSize_; }
+
+    /**
+     * @brief True if the observation contains the gait clock, which then advances every policy step.
+     */
+    bool hasGait() const { return hasGait_; }
+
+private:
+    struct Entry {
+        ObservationTerm term;
+        int source;    // Joint, IMU component (0-2 gyro, 3-5 gravity) or gait component
+        float bias;    // Subtracted before scaling (default joint angle)
+        float scale;
+    };
+
+    void addImu(ObservationTerm term) {
+        const int base = term == ObservationTerm::ANG_VEL ? 0 : 3;
+        for (int i = 0; i < 3; ++i) {
+            entries_.push_back(Entry{term, base + i, 0.0f, 1.0f});
+        }
+    }
+
+    // Observation slot i of count joint values reads joint jointOrder(i); isaaclab interleaves left and right
+    static int jointOrder(const PolicyConfig& config, int i, int count) {
+        return config.isaaclab() ? (i % 2) * (count / 2) + i / 2 : i;
+    }
+
+    // Gyro (scaled) and projected gravity R(q)^T * (0, 0, -1), both rotated by the IMU mounting offset
+    void rotateImu(const ImuData& imu, float out[6]) const {
+        float w = imu.quat[0], x = imu.quat[1], y = imu.quat[2], z = imu.quat[3];
+        const float norm = std::sqrt(w * w + x * x + y * y + z * z);
+        if (norm > 0.0f) {
+            w /= norm;
+            x /= norm;
+            y /= norm;
+            z /= norm;
+        } else {
+            w = 1.0f;
+        }
+        const float gravity[3] = {-2.0f * (x * z - w * y), -2.0f * (y * z + w * x), -(1.0f - 2.0f * (x * x + y * y))};
+        for (int r = 0; r < 3; ++r) {
+            out[r] = (offset_[r][0] * imu.gyro[0] + offset_[r][1] * imu.gyro[1] + offset_[r][2] * imu.gyro[2]) *
+                     angVelScale_;
+            out[3 + r] = offset_[r][0] * gravity[0] + offset_[r][1] * gravity[1] + offset_[r][2] * gravity[2];
+        }
+    }
+
+    // scipy Rotation.from_euler('zyx', angles): extrinsic, R = Rx(a2) * Ry(a1) * Rz(a0)
+    static void offsetRotation(const float angles[3], float out[3][3]) {
+        const double cz = std::cos(angles[0]), sz = std::sin(angles[0]);
+        const double cy = std::cos(angles[1]), sy = std::sin(angles[1]);
+        const double cx = std::cos(angles[2]), sx = std::sin(angles[2]);
+        const double m[3][3] = {
+            {cy * cz, -cy * sz, sy},
+            {sx * sy * cz + cx * sz, -sx * sy * sz + cx * cz, -sx * cy},
+            {-cx * sy * cz + sx * sz, cx * sy * sz + sx * cz, cx * cy}};
+        for (int r = 0; r < 3; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                out[r][c] = static_cast<float>(m[r][c]);
+            }
+        }
+    }
+
+    std::vector<Entry> entries_;
+    bool hasGait_ = false;
+    float clip_ = 100.0f;
+    float angVelScale_ = 1.0f;
+    float gaitFrequency_ = 0.0f;
+    float gaitSwingHeight_ = 0.0f;
+    int commandsSize_ = 0;
+    float commandScales_[3] = {1.0f, 1.0f, 1.0f};
+    float offset_[3][3];
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // OBSERVATION_BUILDER_H
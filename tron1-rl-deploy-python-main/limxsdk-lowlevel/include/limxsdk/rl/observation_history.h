@@ -0,0 +1,106 @@
+/**
+ * @file observation_history.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef OBSERVATION_HISTORY_H
+#define OBSERVATION_HISTORY_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class ObservationHistory
+ * @brief Fixed-length observation history readable as one contiguous oldest-to-newest array.
+ *
+ * The storage holds the ring of slots twice in a row. An observation is
+ * written into the slot of the oldest entry and mirrored into the same
+ * slot of the second copy, so the window starting at the new oldest entry
+ * always spans the whole history in order without wrapping. view() is that
+ * window and can be handed to the encoder as its input; nothing is shifted.
+ *
+ * Usage per step: build the observation into next(), then push().
+ */
+class LIMX_SDK_API ObservationHistory {
+public:
+    /**
+     * @brief Sizes the history for @p slots observations of @p size floats, all zero.
+     */
+    void configure(size_t slots, size_t size) {
+        slots_ = slots;
+        size_ = size;
+        data_.assign(2 * slots * size, 0.0f);
+        head_ = 0;
+    }
+
+    /**
+     * @brief Zeroes all entries.
+     */
+    void clear() {
+        std::fill(data_.begin(), data_.end(), 0.0f);
+        head_ = 0;
+    }
+
+    /**
+     * @brief Where the next observation is written; it replaces the oldest entry on push().
+     */
+    float* next() { return data_.data() + head_ * size_; }
+
+    /**
+     * @brief Makes the observation written into next() the newest entry.
+     */
+    void push() {
+        const float* slot = data_.data() + head_ * size_;
+        std::copy(slot, slot + size_, data_.data() + (head_ + slots_) * size_);
+        head_ = head_ + 1 == slots_ ? 0 : head_ + 1;
+    }
+
+    /**
+     * @brief Copies the newest entry into the @p count oldest ones, e.g. to start from the first observation.
+     */
+    void seed(size_t count) {
+        const float* latest = newest();
+        float* window = data_.data() + head_ * size_;
+        count = std::min(count, slots_ - 1);
+        for (size_t i = 0; i < count; ++i) {
+            std::copy(latest, latest + size_, window + i * size_);
+        }
+        // Mirror the rewritten slots so both copies agree again
+        for (size_t i = 0; i < count; ++i) {
+            const size_t slot = (head_ + i) % slots_;
+            const float* source = window + i * size_;
+            float* first = data_.data() + slot * size_;
+            if (first != source) {
+                std::copy(source, source + size_, first);
+            } else {
+                std::copy(source, source + size_, data_.data() + (slot + slots_) * size_);
+            }
+        }
+    }
+
+    /**
+     * @brief slots() * size() floats, oldest entry first.
+     */
+    const float* view() const { return data_.data() + head_ * size_; }
+
+    const float* newest() const { return view() + (slots_ - 1) * size_; }
+    size_t slots() const { return slots_; }
+    size_t size() const { return size_; }
+
+private:
+    std::vector<float> data_;
+    size_t slots_ = 0;
+    size_t size_ = 0;
+    size_t head_ = 0;   // Ring slot of the oldest entry
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // OBSERVATION_HISTORY_H
@@ -0,0 +1,374 @@
+/**
+ * @file onnx_model.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef ONNX_MODEL_H
+#define ONNX_MODEL_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @struct OnnxNode
+ * @brief One graph node with the attributes the MLP importer understands.
+ */
+struct LIMX_SDK_API OnnxNode {
+    std::string opType;
+    std::vector<std::string> inputs;
+    std::vector<std::string> outputs;
+    std::map<std::string, float> floatAttributes;
+    std::map<std::string, int64_t> intAttributes;
+};
+
+/**
+ * @struct OnnxTensor
+ * @brief A float32 initializer.
+ */
+struct LIMX_SDK_API OnnxTensor {
+    std::vector<int64_t> dims;
+    std::vector<float> data;
+};
+
+/**
+ * @class OnnxModel
+ * @brief Minimal reader for the parts of an ONNX ModelProto needed to import small MLPs.
+ *
+ * Decodes the protobuf wire format directly, so no protobuf or ONNX
+ * library is required. Only float32 initializers are kept; graphs using
+ * other tensor types are rejected by the importer rather than here.
+ */
+class LIMX_SDK_API OnnxModel {
+public:
+    bool load(const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            std::cerr << "Cannot open " << path << std::endl;
+            return false;
+        }
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        nodes_.clear();
+        initializers_.clear();
+        inputs_.clear();
+        outputs_.clear();
+
+        Reader model(bytes.data(), bytes.size());
+        bool hasGraph = false;
+        while (model.more()) {
+            Field field;
+            if (!model.next(field)) {
+                return fail(path);
+            }
+            if (field.number == 7 && field.wire == WIRE_BYTES) {   // ModelProto.graph
+                if (!parseGraph(Reader(field.data, field.size))) {
+                    return fail(path);
+                }
+                hasGraph = true;
+            }
+        }
+        if (!hasGraph) {
+            return fail(path);
+        }
+        return true;
+    }
+
+    const std::vector<OnnxNode>& nodes() const { return nodes_; }
+    const std::vector<std::string>& inputs() const { return inputs_; }
+    const std::vector<std::string>& outputs() const { return outputs_; }
+
+    /**
+     * @brief Returns the initializer named @p name, or nullptr.
+     */
+    const OnnxTensor* initializer(const std::string& name) const {
+        auto it = initializers_.find(name);
+        return it == initializers_.end() ? nullptr : &it->second;
+    }
+
+private:
+    enum WireType { WIRE_VARINT = 0, WIRE_FIXED64 = 1, WIRE_BYTES = 2, WIRE_FIXED32 = 5 };
+
+    struct Field {
+        uint32_t number;
+        uint32_t wire;
+        uint64_t value;       // Varint and fixed values
+        const uint8_t* data;  // Length-delimited payload
+        size_t size;
+    };
+
+    // Sequential protobuf field decoder over a byte range
+    class Reader {
+    public:
+        Reader(const uint8_t* data, size_t size) : pos_(data), end_(data + size) {}
+
+        bool more() const { return pos_ < end_; }
+
+        bool varint(uint64_t& out) {
+            out = 0;
+            for (int shift = 0; shift < 64 && pos_ < end_; shift += 7) {
+                const uint8_t byte = *pos_++;
+                out |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool next(Field& field) {
+            uint64_t key;
+            if (!varint(key)) {
+                return false;
+            }
+            field.number = static_cast<uint32_t>(key >> 3);
+            field.wire = static_cast<uint32_t>(key & 7);
+            field.data = nullptr;
+            field.size = 0;
+            switch (field.wire) {
+            case WIRE_VARINT:
+                return varint(field.value);
+            case WIRE_FIXED64:
+                return fixed(field, 8);
+            case WIRE_FIXED32:
+                return fixed(field, 4);
+            case WIRE_BYTES: {
+                uint64_t size;
+                if (!varint(size) || size > static_cast<uint64_t>(end_ - pos_)) {
+                    return false;
+                }
+                field.data = pos_;
+                field.size = static_cast<size_t>(size);
+                pos_ += size;
+                return true;
+            }
+            default:
+                return false;   // Groups are not used by ONNX
+            }
+        }
+
+    private:
+        bool fixed(Field& field, size_t bytes) {
+            if (static_cast<size_t>(end_ - pos_) < bytes) {
+                return false;
+            }
+            field.value = 0;
+            std::memcpy(&field.value, pos_, bytes);   // Protobuf is little-endian, as are all supported targets
+            pos_ += bytes;
+            return true;
+        }
+
+        const uint8_t* pos_;
+        const uint8_t* end_;
+    };
+
+    static std::string str(const Field& field) {
+        return std::string(reinterpret_cast<const char*>(field.data), field.size);
+    }
+
+    bool fail(const std::string& path) {
+        std::cerr << "Malformed ONNX model: " << path << std::endl;
+        return false;
+    }
+
+    bool parseGraph(Reader graph) {
+        Field field;
+        while (graph.more()) {
+            if (!graph.next(field)) {
+                return false;
+            }
+            if (field.wire != WIRE_BYTES) {
+                continue;
+            }
+            if (field.number == 1) {            // GraphProto.node
+                OnnxNode node;
+                if (!parseNode(Reader(field.data, field.size), node)) {
+                    return false;
+                }
+                nodes_.push_back(node);
+            } else if (field.number == 5) {     // GraphProto.initializer
+                std::string name;
+                OnnxTensor tensor;
+                if (!parseTensor(Reader(field.data, field.size), name, tensor)) {
+                    return false;
+                }
+                initializers_[name] = tensor;
+            } else if (field.number == 11 || field.number == 12) {   // GraphProto.input / output
+                std::string name;
+                if (!parseValueInfo(Reader(field.data, field.size), name)) {
+                    return false;
+                }
+                (field.number == 11 ? inputs_ : outputs_).push_back(name);
+            }
+        }
+        // Older exporters also list initializers as graph inputs
+        std::vector<std::string> inputs;
+        for (const auto& name : inputs_) {
+            if (!initializer(name)) {
+                inputs.push_back(name);
+            }
+        }
+        inputs_.swap(inputs);
+        return true;
+    }
+
+    static bool parseNode(Reader reader, OnnxNode& node) {
+        Field field;
+        while (reader.more()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.wire != WIRE_BYTES) {
+                continue;
+            }
+            switch (field.number) {
+            case 1: node.inputs.push_back(str(field)); break;
+            case 2: node.outputs.push_back(str(field)); break;
+            case 4: node.opType = str(field); break;
+            case 5:
+                if (!parseAttribute(Reader(field.data, field.size), node)) {
+                    return false;
+                }
+                break;
+            default: break;
+            }
+        }
+        return true;
+    }
+
+    static bool parseAttribute(Reader reader, OnnxNode& node) {
+        Field field;
+        std::string name;
+        bool hasFloat = false, hasInt = false;
+        float f = 0.0f;
+        int64_t i = 0;
+        while (reader.more()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.number == 1 && field.wire == WIRE_BYTES) {
+                name = str(field);
+            } else if (field.number == 2 && field.wire == WIRE_FIXED32) {
+                const uint32_t bits = static_cast<uint32_t>(field.value);
+                std::memcpy(&f, &bits, sizeof(f));
+                hasFloat = true;
+            } else if (field.number == 3 && field.wire == WIRE_VARINT) {
+                i = static_cast<int64_t>(field.value);
+                hasInt = true;
+            }
+        }
+        if (hasFloat) {
+            node.floatAttributes[name] = f;
+        }
+        if (hasInt) {
+            node.intAttributes[name] = i;
+        }
+        return true;
+    }
+
+    static const uint64_t MAX_TENSOR_ELEMENTS = uint64_t(1) << 32;
+
+    static bool parseTensor(Reader reader, std::string& name, OnnxTensor& tensor) {
+        enum { FLOAT = 1 };
+        Field field;
+        int64_t dataType = FLOAT;
+        std::vector<uint8_t> raw;
+        while (reader.more()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.number == 1) {            // dims, packed or not
+                if (field.wire == WIRE_VARINT) {
+                    tensor.dims.push_back(static_cast<int64_t>(field.value));
+                } else if (field.wire == WIRE_BYTES) {
+                    Reader packed(field.data, field.size);
+                    uint64_t dim;
+                    while (packed.more() && packed.varint(dim)) {
+                        tensor.dims.push_back(static_cast<int64_t>(dim));
+                    }
+                }
+            } else if (field.number == 2 && field.wire == WIRE_VARINT) {
+                dataType = static_cast<int64_t>(field.value);
+            } else if (field.number == 4) {     // float_data
+                if (field.wire == WIRE_BYTES) {
+                    if (field.size % sizeof(float) != 0) {
+                        std::cerr << "ONNX tensor has truncated float_data" << std::endl;
+                        return false;
+                    }
+                    const size_t count = field.size / sizeof(float);
+                    const size_t offset = tensor.data.size();
+                    tensor.data.resize(offset + count);
+                    std::memcpy(tensor.data.data() + offset, field.data, count * sizeof(float));
+                } else if (field.wire == WIRE_FIXED32) {
+                    float value;
+                    const uint32_t bits = static_cast<uint32_t>(field.value);
+                    std::memcpy(&value, &bits, sizeof(value));
+                    tensor.data.push_back(value);
+                }
+            } else if (field.number == 8 && field.wire == WIRE_BYTES) {
+                name = str(field);
+            } else if (field.number == 9 && field.wire == WIRE_BYTES) {   // raw_data
+                raw.assign(field.data, field.data + field.size);
+            } else if (field.number == 13) {
+                std::cerr << "ONNX external tensor data is not supported" << std::endl;
+                return false;
+            }
+        }
+        if (dataType != FLOAT) {
+            tensor.dims.clear();
+            tensor.data.clear();
+            return true;
+        }
+        if (!raw.empty()) {
+            tensor.data.resize(raw.size() / sizeof(float));
+            std::memcpy(tensor.data.data(), raw.data(), tensor.data.size() * sizeof(float));
+        }
+        // Importers index the data by dims, so a truncated or oversized tensor must not load
+        uint64_t count = 1;
+        for (int64_t dim : tensor.dims) {
+            if (dim < 0 || (dim > 0 && count > MAX_TENSOR_ELEMENTS / static_cast<uint64_t>(dim))) {
+                std::cerr << "ONNX tensor " << name << " has invalid dimensions" << std::endl;
+                return false;
+            }
+            count *= static_cast<uint64_t>(dim);
+        }
+        if (count != tensor.data.size() || raw.size() % sizeof(float) != 0) {
+            std::cerr << "ONNX tensor " << name << " has " << tensor.data.size() << " values, its dimensions need "
+                      << count << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    static bool parseValueInfo(Reader reader, std::string& name) {
+        Field field;
+        while (reader.more()) {
+            if (!reader.next(field)) {
+                return false;
+            }
+            if (field.number == 1 && field.wire == WIRE_BYTES) {
+                name = str(field);
+            }
+        }
+        return true;
+    }
+
+    std::vector<OnnxNode> nodes_;
+    std::map<std::string, OnnxTensor> initializers_;
+    std::vector<std::string> inputs_;
+    std::vector<std::string> outputs_;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // ONNX_MODEL_H
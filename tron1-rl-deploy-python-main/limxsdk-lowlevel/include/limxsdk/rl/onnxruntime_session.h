@@ -0,0 +1,135 @@
+/**
+ * @file onnxruntime_session.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef ONNXRUNTIME_SESSION_H
+#define ONNXRUNTIME_SESSION_H
+
+#ifdef LIMX_SDK_WITH_ONNXRUNTIME
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <onnxruntime_cxx_api.h>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/inference_session.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class OnnxRuntimeSession
+ * @brief InferenceSession on ONNX Runtime's CPU provider.
+ *
+ * Uses the session options of the Python controllers (one thread, full
+ * graph optimization, no arena). The input and output tensors wrap buffers
+ * owned by the session and are bound once through an IoBinding, so run()
+ * only copies and executes; ONNX Runtime neither allocates outputs nor
+ * looks up names per call.
+ */
+class LIMX_SDK_API OnnxRuntimeSession : public InferenceSession {
+public:
+    OnnxRuntimeSession()
+        : memoryInfo_(Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault)) {}
+
+    bool load(const std::string& path) override {
+        binding_.reset();
+        try {
+            Ort::SessionOptions options;
+            options.SetIntraOpNumThreads(1);
+            options.SetInterOpNumThreads(1);
+            options.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_ALL);
+            options.DisableCpuMemArena();
+            options.DisableMemPattern();
+            session_ = std::unique_ptr<Ort::Session>(new Ort::Session(env(), path.c_str(), options));
+
+            if (session_->GetInputCount() != 1 || session_->GetOutputCount() != 1) {
+                std::cerr << path << ": expected one input and one output" << std::endl;
+                return false;
+            }
+            Ort::AllocatorWithDefaultOptions allocator;
+            inputName_ = session_->GetInputNameAllocated(0, allocator).get();
+            outputName_ = session_->GetOutputNameAllocated(0, allocator).get();
+            inputShape_ = session_->GetInputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+            outputShape_ = session_->GetOutputTypeInfo(0).GetTensorTypeAndShapeInfo().GetShape();
+            input_.assign(elementCount(inputShape_), 0.0f);
+            output_.assign(elementCount(outputShape_), 0.0f);
+
+            inputTensor_ = Ort::Value::CreateTensor<float>(memoryInfo_, input_.data(), input_.size(),
+                                                           inputShape_.data(), inputShape_.size());
+            outputTensor_ = Ort::Value::CreateTensor<float>(memoryInfo_, output_.data(), output_.size(),
+                                                            outputShape_.data(), outputShape_.size());
+            binding_ = std::unique_ptr<Ort::IoBinding>(new Ort::IoBinding(*session_));
+            binding_->BindInput(inputName_.c_str(), inputTensor_);
+            binding_->BindOutput(outputName_.c_str(), outputTensor_);
+        } catch (const Ort::Exception& e) {
+            std::cerr << "Failed to load " << path << ": " << e.what() << std::endl;
+            binding_.reset();
+            session_.reset();
+            return false;
+        }
+        return true;
+    }
+
+    size_t inputSize() const override { return input_.size(); }
+    size_t outputSize() const override { return output_.size(); }
+
+    bool run(const float* input, float* output) override {
+        if (!session_ || !binding_) {
+            return false;
+        }
+        std::copy(input, input + input_.size(), input_.begin());
+        try {
+            session_->Run(runOptions_, *binding_);
+        } catch (const Ort::Exception& e) {
+            std::cerr << "Inference failed: " << e.what() << std::endl;
+            return false;
+        }
+        std::copy(output_.begin(), output_.end(), output);
+        return true;
+    }
+
+    const char* backend() const override { return "onnxruntime"; }
+
+private:
+    static Ort::Env& env() {
+        static Ort::Env instance(ORT_LOGGING_LEVEL_WARNING, "limxsdk");
+        return instance;
+    }
+
+    // Dynamic dimensions are treated as 1: the bundled models take one sample
+    static size_t elementCount(std::vector<int64_t>& shape) {
+        size_t count = 1;
+        for (auto& dim : shape) {
+            if (dim <= 0) {
+                dim = 1;
+            }
+            count *= static_cast<size_t>(dim);
+        }
+        return count;
+    }
+
+    Ort::MemoryInfo memoryInfo_;
+    Ort::RunOptions runOptions_;
+    std::unique_ptr<Ort::Session> session_;
+    std::string inputName_;
+    std::string outputName_;
+    std::vector<int64_t> inputShape_;
+    std::vector<int64_t> outputShape_;
+    std::vector<float> input_;
+    std::vector<float> output_;
+    Ort::Value inputTensor_{nullptr};
+    Ort::Value outputTensor_{nullptr};
+    std::unique_ptr<Ort::IoBinding> binding_;   // Declared last: released before the tensors and session
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // LIMX_SDK_WITH_ONNXRUNTIME
+
+#endif // ONNXRUNTIME_SESSION_H
@@ -0,0 +1,313 @@
+/**
+ * @file policy_config.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef POLICY_CONFIG_H
+#define POLICY_CONFIG_H
+
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "limxsdk/macros.h"
+#include "limxsdk/trajectory/joint_trajectory.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @brief Robot families of the bundled policies, taken from the ROBOT_TYPE prefix.
+ */
+enum class RobotFamily {
+    POINTFOOT,   // PF_*: point feet, gait clock in the observation
+    SOLEFOOT,    // SF_*: ankle joints and configurable gait
+    WHEELFOOT    // WF_*: wheel joints commanded in velocity
+};
+
+/**
+ * @brief Role of a joint in the action mapping.
+ */
+enum class JointKind {
+    LEG,     // Position target with the leg PD gains
+    ANKLE,   // Position target with the ankle damping and torque limit
+    WHEEL    // Velocity target with the wheel damping
+};
+
+/**
+ * @struct JointLimit
+ * @brief One joint_limits entry; joints without one are unbounded.
+ */
+struct LIMX_SDK_API JointLimit {
+    float lower = -std::numeric_limits<float>::infinity();     // Position, rad
+    float upper = std::numeric_limits<float>::infinity();
+    float effort = std::numeric_limits<float>::infinity();     // Torque, Nm
+    float velocity = std::numeric_limits<float>::infinity();   // rad/s
+};
+
+/**
+ * @struct PolicyConfig
+ * @brief Contents of controllers/model/<ROBOT_TYPE>/params.yaml plus the policy file locations.
+ *
+ * Field meanings follow the PointfootCfg section read by the Python
+ * controllers, so one params.yaml drives both implementations.
+ */
+struct LIMX_SDK_API PolicyConfig {
+    std::string robotType;                // e.g. "PF_TRON1A"
+    std::string rlType;                   // "isaacgym" or "isaaclab"
+    std::string encoderPath;
+    std::string policyPath;
+    RobotFamily family = RobotFamily::POINTFOOT;
+
+    double loopFrequency = 500.0;
+    std::vector<std::string> jointNames;
+    std::vector<JointKind> jointKinds;
+    std::vector<float> defaultJointAngles;   // Action offsets in walk mode
+    std::vector<float> standJointAngles;     // Targets reached at the end of stand mode
+    std::vector<JointLimit> jointLimits;     // Optional joint_limits (URDF values), per joint
+
+    // control
+    float stiffness = 0.0f;
+    float damping = 0.0f;
+    float actionScale = 0.25f;
+    int decimation = 10;
+    float torqueLimit = 80.0f;
+    float ankleDamping = 0.0f;
+    float ankleTorqueLimit = 0.0f;
+    float wheelDamping = 0.0f;
+    float wheelTorqueLimit = 0.0f;
+
+    // normalization
+    float clipObservations = 100.0f;
+    float clipActions = 100.0f;
+    float linVelScale = 2.0f;
+    float angVelScale = 0.25f;
+    float dofPosScale = 1.0f;
+    float dofVelScale = 0.05f;
+
+    // size
+    int actionsSize = 0;
+    int observationsSize = 0;
+    int commandsSize = 3;
+    int historyLength = 1;
+    int encoderOutputSize = 0;
+    std::vector<int> jointPosIdxs;           // Joints whose position is observed (WF excludes wheels)
+    std::vector<std::string> observationTerms;   // Observation layout, see ObservationTerm
+
+    float gaitFrequency = 2.0f;
+    float gaitSwingHeight = 0.1f;
+    double standDuration = 1.0;
+    std::string standProfileName = "linear";     // Optional stand_mode.profile; linear matches Python
+    trajectory::Profile standProfile = trajectory::Profile::LINEAR;
+    float imuOrientationOffset[3] = {0.0f, 0.0f, 0.0f};  // roll, pitch, yaw entries in file order
+    float userCmdScales[3] = {1.0f, 1.0f, 1.0f};         // lin_vel_x, lin_vel_y, ang_vel_yaw
+
+    // inference (optional section, C++ controller only)
+    bool pipelinedEncoder = false;   // Overlap the encoder with the policy; the latent lags one policy step
+    int encoderCpu = -1;             // CPU of the pipelined encoder thread, -1 to leave it unpinned
+
+    bool isaaclab() const { return rlType == "isaaclab"; }
+    int jointCount() const { return static_cast<int>(jointNames.size()); }
+
+    /**
+     * @brief Number of commands fed to the policy; the isaaclab sole-foot policies drop the two gait commands.
+     */
+    int policyCommandsSize() const {
+        return family == RobotFamily::SOLEFOOT && isaaclab() ? commandsSize - 2 : commandsSize;
+    }
+
+    /**
+     * @brief Loads @p modelDir/@p robotType/params.yaml and resolves the encoder and policy of @p rlType.
+     * @return False if the file is missing or incomplete; the reason is printed.
+     */
+    bool load(const std::string& modelDir, const std::string& robot, const std::string& rl) {
+        robotType = robot;
+        rlType = rl;
+        const std::string base = modelDir + "/" + robotType;
+        encoderPath = base + "/policy/" + rlType + "/encoder.onnx";
+        policyPath = base + "/policy/" + rlType + "/policy.onnx";
+
+        if (robotType.compare(0, 2, "PF") == 0) {
+            family = RobotFamily::POINTFOOT;
+        } else if (robotType.compare(0, 2, "SF") == 0) {
+            family = RobotFamily::SOLEFOOT;
+        } else if (robotType.compare(0, 2, "WF") == 0) {
+            family = RobotFamily::WHEELFOOT;
+        } else {
+            std::cerr << "Unknown robot type: " << robotType << std::endl;
+            return false;
+        }
+
+        const std::string file = base + "/params.yaml";
+        try {
+            YAML::Node root = YAML::LoadFile(file)["PointfootCfg"];
+            if (!root) {
+                std::cerr << "Missing PointfootCfg in " << file << std::endl;
+                return false;
+            }
+            parse(root);
+        } catch (const YAML::Exception& e) {
+            std::cerr << "Error parsing " << file << ": " << e.what() << std::endl;
+            return false;
+        }
+        return validate(file);
+    }
+
+private:
+    void parse(const YAML::Node& root) {
+        loopFrequency = root["loop_frequency"].as<double>();
+        jointNames = root["joint_names"].as<std::vector<std::string>>();
+
+        const YAML::Node angles = root["init_state"]["default_joint_angle"];
+        defaultJointAngles.clear();
+        jointKinds.clear();
+        for (const auto& name : jointNames) {
+            defaultJointAngles.push_back(angles[name].as<float>());
+            if (family == RobotFamily::WHEELFOOT && name.find("wheel") != std::string::npos) {
+                jointKinds.push_back(JointKind::WHEEL);
+            } else if (family == RobotFamily::SOLEFOOT && name.find("ankle") != std::string::npos) {
+                jointKinds.push_back(JointKind::ANKLE);
+            } else {
+                jointKinds.push_back(JointKind::LEG);
+            }
+        }
+        standJointAngles = defaultJointAngles;
+
+        const YAML::Node limits = root["joint_limits"];
+        jointLimits.assign(jointNames.size(), JointLimit());
+        for (size_t j = 0; limits && j < jointNames.size(); ++j) {
+            const YAML::Node limit = limits[jointNames[j]];
+            if (!limit) {
+                continue;
+            }
+            JointLimit& out = jointLimits[j];
+            out.lower = limit["lower"].as<float>(out.lower);
+            out.upper = limit["upper"].as<float>(out.upper);
+            out.effort = limit["effort"].as<float>(out.effort);
+            out.velocity = limit["velocity"].as<float>(out.velocity);
+        }
+
+        const YAML::Node control = root["control"];
+        stiffness = control["stiffness"].as<float>();
+        damping = control["damping"].as<float>();
+        actionScale = control["action_scale_pos"].as<float>();
+        decimation = control["decimation"].as<int>();
+        torqueLimit = control["user_torque_limit"].as<float>();
+        if (control["ankle_joint_damping"]) {
+            ankleDamping = control["ankle_joint_damping"].as<float>();
+            ankleTorqueLimit = control["ankle_joint_torque_limit"].as<float>();
+        }
+        if (control["wheel_joint_damping"]) {
+            wheelDamping = control["wheel_joint_damping"].as<float>();
+            wheelTorqueLimit = control["wheel_joint_torque_limit"].as<float>();
+        }
+
+        const YAML::Node normalization = root["normalization"];
+        clipObservations = normalization["clip_scales"]["clip_observations"].as<float>();
+        clipActions = normalization["clip_scales"]["clip_actions"].as<float>();
+        linVelScale = normalization["obs_scales"]["lin_vel"].as<float>();
+        angVelScale = normalization["obs_scales"]["ang_vel"].as<float>();
+        dofPosScale = normalization["obs_scales"]["dof_pos"].as<float>();
+        dofVelScale = normalization["obs_scales"]["dof_vel"].as<float>();
+
+        const YAML::Node size = root["size"];
+        actionsSize = size["actions_size"].as<int>();
+        observationsSize = size["observations_size"].as<int>();
+        commandsSize = size["commands_size"].as<int>();
+        historyLength = size["obs_history_length"].as<int>();
+        encoderOutputSize = size["encoder_output_size"].as<int>();
+        jointPosIdxs.clear();
+        if (size["jointpos_idxs"]) {
+            jointPosIdxs = size["jointpos_idxs"].as<std::vector<int>>();
+        } else {
+            for (int i = 0; i < jointCount(); ++i) {
+                jointPosIdxs.push_back(i);
+            }
+        }
+
+        // Optional; the bundled policies observe the gait clock unless they have wheels
+        if (size["observation_terms"]) {
+            observationTerms = size["observation_terms"].as<std::vector<std::string>>();
+        } else {
+            observationTerms = {"ang_vel", "projected_gravity", "dof_pos", "dof_vel", "last_actions"};
+            if (family != RobotFamily::WHEELFOOT) {
+                observationTerms.push_back("gait");
+            }
+        }
+
+        if (root["gait"]) {
+            gaitFrequency = root["gait"]["frequencies"].as<float>();
+            gaitSwingHeight = root["gait"]["swing_height"].as<float>();
+        }
+        standDuration = root["stand_mode"]["stand_duration"].as<double>();
+        standProfileName = root["stand_mode"]["profile"].as<std::string>("linear");
+        trajectory::parseProfile(standProfileName, standProfile);
+
+        // The Python controllers pass the values in file order, so keep that order
+        const YAML::Node offset = root["imu_orientation_offset"];
+        int i = 0;
+        for (auto it = offset.begin(); it != offset.end() && i < 3; ++it, ++i) {
+            imuOrientationOffset[i] = it->second.as<float>();
+        }
+
+        const YAML::Node scales = root["user_cmd_scales"];
+        userCmdScales[0] = scales["lin_vel_x"].as<float>();
+        userCmdScales[1] = scales["lin_vel_y"].as<float>();
+        userCmdScales[2] = scales["ang_vel_yaw"].as<float>();
+
+        const YAML::Node inference = root["inference"];
+        if (inference) {
+            pipelinedEncoder = inference["pipelined_encoder"].as<bool>(false);
+            encoderCpu = inference["encoder_cpu"].as<int>(-1);
+        }
+
+        // Wheel-foot robots stand up with folded hips before walking with straight ones
+        if (family == RobotFamily::WHEELFOOT) {
+            for (int j = 0; j < jointCount(); ++j) {
+                if (jointNames[j] == "hip_L_Joint") {
+                    standJointAngles[j] = -0.9f;
+                    defaultJointAngles[j] = 0.0f;
+                } else if (jointNames[j] == "hip_R_Joint") {
+                    standJointAngles[j] = 0.9f;
+                    defaultJointAngles[j] = 0.0f;
+                }
+            }
+        }
+    }
+
+    bool validate(const std::string& file) const {
+        if (actionsSize != jointCount()) {
+            std::cerr << file << ": actions_size " << actionsSize << " does not match "
+                      << jointCount() << " joints" << std::endl;
+            return false;
+        }
+        if (decimation <= 0 || loopFrequency <= 0.0 || stiffness <= 0.0f || historyLength <= 0) {
+            std::cerr << file << ": invalid control parameters" << std::endl;
+            return false;
+        }
+        for (int idx : jointPosIdxs) {
+            if (idx < 0 || idx >= jointCount()) {
+                std::cerr << file << ": jointpos_idxs entry " << idx << " out of range" << std::endl;
+                return false;
+            }
+        }
+        trajectory::Profile profile;
+        if (!trajectory::parseProfile(standProfileName, profile) || profile == trajectory::Profile::TRAPEZOIDAL) {
+            std::cerr << file << ": stand_mode profile must be linear, cubic, quintic or min_jerk, not "
+                      << standProfileName << std::endl;
+            return false;
+        }
+        if (family == RobotFamily::WHEELFOOT && wheelDamping <= 0.0f) {
+            std::cerr << file << ": wheel_joint_damping must be positive" << std::endl;
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // POLICY_CONFIG_H
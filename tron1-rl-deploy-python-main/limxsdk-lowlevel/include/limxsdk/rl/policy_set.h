@@ -0,0 +1,173 @@
+/**
+ * @file policy_set.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef POLICY_SET_H
+#define POLICY_SET_H
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/datatypes.h"
+#include "limxsdk/rl/locomotion_controller.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @class PolicySet
+ * @brief Preloaded locomotion policies for one robot, one of them active.
+ *
+ * Every policy keeps its own LocomotionController with loaded sessions and
+ * buffers, so select() never loads or allocates. A selected policy takes
+ * over at the next decimation boundary of the active one (see
+ * LocomotionController::takeOver()). With a crossfade of K policy steps the
+ * outgoing policy keeps running for K of the incoming policy's decimation
+ * periods and the joint commands are blended linearly from it to the
+ * incoming one.
+ */
+class LIMX_SDK_API PolicySet {
+public:
+    /**
+     * @brief Adds a policy under @p name; it must drive the same joints at the same rate as the first.
+     */
+    bool add(const std::string& name, const PolicyConfig& config, std::unique_ptr<InferenceSession> encoder,
+             std::unique_ptr<InferenceSession> policy) {
+        if (!controllers_.empty()) {
+            const PolicyConfig& first = controllers_.front()->config();
+            if (config.jointNames != first.jointNames || config.loopFrequency != first.loopFrequency) {
+                std::cerr << name << ": joints or loop frequency differ from " << names_.front() << std::endl;
+                return false;
+            }
+        }
+        std::unique_ptr<LocomotionController> controller(new LocomotionController());
+        if (!controller->init(config, std::move(encoder), std::move(policy))) {
+            return false;
+        }
+        if (controllers_.empty()) {
+            controller->prepareCommand(fadeCmd_);
+        }
+        controllers_.push_back(std::move(controller));
+        names_.push_back(name);
+        return true;
+    }
+
+    /**
+     * @brief Blends over @p steps policy steps of the incoming policy when switching, 0 to cut over.
+     */
+    void setCrossfade(int steps) { crossfadeSteps_ = steps > 0 ? steps : 0; }
+
+    /**
+     * @brief Restarts the active policy from stand mode and drops pending switches.
+     */
+    void reset() {
+        pending_ = -1;
+        fading_ = -1;
+        active().reset();
+    }
+
+    /**
+     * @brief Requests a switch to policy @p index at the next decimation boundary.
+     */
+    bool select(size_t index) {
+        if (index >= controllers_.size()) {
+            return false;
+        }
+        pending_ = index == active_ ? -1 : static_cast<int>(index);
+        return true;
+    }
+
+    /**
+     * @brief Index of the policy named @p name, or -1.
+     */
+    int find(const std::string& name) const {
+        for (size_t i = 0; i < names_.size(); ++i) {
+            if (names_[i] == name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void setCommands(float linearX, float linearY, float angularZ) {
+        active().setCommands(linearX, linearY, angularZ);
+        if (fading_ >= 0) {
+            controllers_[fading_]->setCommands(linearX, linearY, angularZ);
+        }
+    }
+
+    /**
+     * @brief Runs one control cycle of the active policy, switching or blending as requested.
+     */
+    bool update(const float* q, const float* dq, const ImuData& imu, RobotCmd& cmd) {
+        if (pending_ >= 0 && active().inferenceDue()) {
+            LocomotionController& incoming = *controllers_[pending_];
+            incoming.takeOver(active());
+            if (crossfadeSteps_ > 0) {
+                fading_ = static_cast<int>(active_);
+                fadeTick_ = 0;
+                fadeTicks_ = crossfadeSteps_ * incoming.config().decimation;
+            }
+            active_ = static_cast<size_t>(pending_);
+            pending_ = -1;
+            switches_++;
+        }
+
+        bool ok = active().update(q, dq, imu, cmd);
+        if (fading_ >= 0) {
+            ok = controllers_[fading_]->update(q, dq, imu, fadeCmd_) && ok;
+            fadeTick_++;
+            blend(static_cast<float>(fadeTick_) / (fadeTicks_ + 1), cmd);
+            if (fadeTick_ >= fadeTicks_) {
+                fading_ = -1;
+            }
+        }
+        return ok;
+    }
+
+    size_t size() const { return controllers_.size(); }
+    const std::string& name(size_t index) const { return names_[index]; }
+    size_t activeIndex() const { return active_; }
+    LocomotionController& controller(size_t index) { return *controllers_[index]; }
+    LocomotionController& active() { return *controllers_[active_]; }
+    const LocomotionController& active() const { return *controllers_[active_]; }
+
+    /**
+     * @brief True while a switch waits for its boundary or the crossfade runs.
+     */
+    bool switching() const { return pending_ >= 0 || fading_ >= 0; }
+    uint64_t switches() const { return switches_; }
+
+private:
+    // cmd = weight * cmd + (1 - weight) * fadeCmd_ on every commanded quantity
+    void blend(float weight, RobotCmd& cmd) const {
+        std::vector<float>* to[5] = {&cmd.q, &cmd.dq, &cmd.tau, &cmd.Kp, &cmd.Kd};
+        const std::vector<float>* from[5] = {&fadeCmd_.q, &fadeCmd_.dq, &fadeCmd_.tau, &fadeCmd_.Kp, &fadeCmd_.Kd};
+        for (int f = 0; f < 5; ++f) {
+            for (size_t j = 0; j < to[f]->size(); ++j) {
+                (*to[f])[j] = weight * (*to[f])[j] + (1.0f - weight) * (*from[f])[j];
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<LocomotionController>> controllers_;
+    std::vector<std::string> names_;
+    size_t active_ = 0;
+    int pending_ = -1;           // Policy waiting for the next boundary
+    int fading_ = -1;            // Outgoing policy during a crossfade
+    int crossfadeSteps_ = 0;
+    int fadeTick_ = 0;
+    int fadeTicks_ = 0;
+    uint64_t switches_ = 0;
+    RobotCmd fadeCmd_;           // Command of the outgoing policy
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // POLICY_SET_H
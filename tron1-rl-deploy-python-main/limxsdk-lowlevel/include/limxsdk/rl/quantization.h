@@ -0,0 +1,183 @@
+/**
+ * @file quantization.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef QUANTIZATION_H
+#define QUANTIZATION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/mlp_session.h"
+#include "limxsdk/rl/policy_config.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @struct QuantizationReport
+ * @brief Calibration result of one weight precision for an encoder/policy pair.
+ *
+ * Errors are the largest |action - fp32 action| over the joints of one
+ * inference step, in policy action units (before action_scale), collected
+ * over all replayed steps.
+ */
+struct LIMX_SDK_API QuantizationReport {
+    Precision precision = Precision::FP32;
+    uint64_t encoderFingerprint = 0;
+    uint64_t policyFingerprint = 0;
+    uint64_t samples = 0;
+    double meanError = 0.0;
+    double p50Error = 0.0;
+    double p99Error = 0.0;
+    double maxError = 0.0;
+    double bound = 0.0;              // Bound the calibration was run against
+    double fp32Ns = 0.0;             // Mean encoder + policy time per step
+    double quantizedNs = 0.0;
+
+    bool passed() const { return maxError <= bound; }
+    double speedup() const { return quantizedNs > 0.0 ? fp32Ns / quantizedNs : 0.0; }
+};
+
+/**
+ * @brief FNV-1a hash of a model file, binding a report to the exact weights it was measured on.
+ * @return 0 if the file cannot be read.
+ */
+inline uint64_t modelFingerprint(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return 0;
+    }
+    uint64_t hash = 14695981039346656037ull;
+    char buffer[4096];
+    while (in.read(buffer, sizeof(buffer)) || in.gcount() > 0) {
+        for (std::streamsize i = 0; i < in.gcount(); ++i) {
+            hash = (hash ^ static_cast<uint8_t>(buffer[i])) * 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+/**
+ * @brief Location of the calibration reports: quantization.yaml next to the policy.
+ */
+inline std::string quantizationReportPath(const PolicyConfig& config) {
+    const size_t slash = config.policyPath.find_last_of('/');
+    return (slash == std::string::npos ? std::string(".") : config.policyPath.substr(0, slash)) + "/quantization.yaml";
+}
+
+/**
+ * @brief Reads the section of @p precision from a report file.
+ */
+inline bool loadQuantizationReport(const std::string& path, Precision precision, QuantizationReport& report) {
+    if (!std::ifstream(path)) {
+        return false;
+    }
+    try {
+        const YAML::Node section = YAML::LoadFile(path)[precisionName(precision)];
+        if (!section) {
+            return false;
+        }
+        report.precision = precision;
+        report.encoderFingerprint = section["encoder_fingerprint"].as<uint64_t>();
+        report.policyFingerprint = section["policy_fingerprint"].as<uint64_t>();
+        report.samples = section["samples"].as<uint64_t>();
+        report.meanError = section["mean_error"].as<double>();
+        report.p50Error = section["p50_error"].as<double>();
+        report.p99Error = section["p99_error"].as<double>();
+        report.maxError = section["max_error"].as<double>();
+        report.bound = section["bound"].as<double>();
+        report.fp32Ns = section["fp32_ns"].as<double>();
+        report.quantizedNs = section["quantized_ns"].as<double>();
+        return true;
+    } catch (const YAML::Exception& e) {
+        std::cerr << path << ": " << e.what() << std::endl;
+        return false;
+    }
+}
+
+/**
+ * @brief Writes one section per report into @p path.
+ *
+ * Sections of precisions without a new report are read from the existing
+ * file and written back unchanged, so calibrating only int8 keeps fp16.
+ */
+inline bool saveQuantizationReports(const std::string& path, const std::vector<QuantizationReport>& reports) {
+    std::vector<QuantizationReport> sections;
+    const Precision precisions[] = {Precision::FP16, Precision::INT8};
+    for (Precision precision : precisions) {
+        auto it = std::find_if(reports.begin(), reports.end(),
+                               [precision](const QuantizationReport& report) { return report.precision == precision; });
+        QuantizationReport report;
+        if (it != reports.end()) {
+            sections.push_back(*it);
+        } else if (loadQuantizationReport(path, precision, report)) {
+            sections.push_back(report);
+        }
+    }
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        std::cerr << "Cannot write " << path << std::endl;
+        return false;
+    }
+    out << "# Written by rl_quantize_calibrate; errors in policy action units\n";
+    for (const auto& report : sections) {
+        out << precisionName(report.precision) << ":\n"
+            << "  encoder_fingerprint: " << report.encoderFingerprint << "\n"
+            << "  policy_fingerprint: " << report.policyFingerprint << "\n"
+            << "  samples: " << report.samples << "\n"
+            << "  mean_error: " << report.meanError << "\n"
+            << "  p50_error: " << report.p50Error << "\n"
+            << "  p99_error: " << report.p99Error << "\n"
+            << "  max_error: " << report.maxError << "\n"
+            << "  bound: " << report.bound << "\n"
+            << "  fp32_ns: " << report.fp32Ns << "\n"
+            << "  quantized_ns: " << report.quantizedNs << "\n"
+            << "  passed: " << (report.passed() ? "true" : "false") << "\n";
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * @brief Decides whether the models of @p config may run with @p precision weights.
+ *
+ * FP32 is always allowed. Otherwise a calibration report for the same
+ * model files must exist and its worst replayed action error must not
+ * exceed @p maxActionError; the reason for a refusal is printed.
+ */
+inline bool quantizedDeploymentAllowed(const PolicyConfig& config, Precision precision, double maxActionError) {
+    if (precision == Precision::FP32) {
+        return true;
+    }
+    const std::string path = quantizationReportPath(config);
+    QuantizationReport report;
+    if (!loadQuantizationReport(path, precision, report)) {
+        std::cerr << "No " << precisionName(precision) << " calibration in " << path
+                  << "; run rl_quantize_calibrate first" << std::endl;
+        return false;
+    }
+    if (report.encoderFingerprint != modelFingerprint(config.encoderPath) ||
+        report.policyFingerprint != modelFingerprint(config.policyPath)) {
+        std::cerr << path << " was calibrated on different model files" << std::endl;
+        return false;
+    }
+    if (report.maxError > maxActionError) {
+        std::cerr << precisionName(precision) << " action error " << report.maxError << " exceeds the bound "
+                  << maxActionError << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // QUANTIZATION_H
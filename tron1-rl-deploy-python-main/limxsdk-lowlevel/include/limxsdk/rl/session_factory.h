@@ -0,0 +1,72 @@
+/**
+ * @file session_factory.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef SESSION_FACTORY_H
+#define SESSION_FACTORY_H
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "limxsdk/rl/inference_session.h"
+#include "limxsdk/rl/mlp_session.h"
+#include "limxsdk/rl/onnxruntime_session.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @brief Creates an unloaded session of the named backend.
+ *
+ * "native" is the built-in MLP engine and is always available. Colon
+ * separated options select a kernel of mlp_kernels::available() and/or
+ * the weight precision, e.g. "native:avx2", "native:int8", "native:neon:fp16".
+ * A kernel that this CPU lacks falls back to the fastest available one.
+ * @return Nullptr if the backend or one of its options is unknown, or the backend was not compiled in.
+ */
+inline std::unique_ptr<InferenceSession> createInferenceSession(const std::string& backend) {
+    if (backend.compare(0, 6, "native") == 0 && (backend.size() == 6 || backend[6] == ':')) {
+        std::string kernel;
+        Precision precision = Precision::FP32;
+        size_t start = 6;
+        while (start < backend.size()) {
+            const size_t end = std::min(backend.find(':', start + 1), backend.size());
+            const std::string option = backend.substr(start + 1, end - start - 1);
+            if (mlp_kernels::isKernelName(option)) {
+                kernel = option;
+            } else if (!parsePrecision(option, precision)) {
+                std::cerr << "Unknown option of inference backend " << backend << ": " << option
+                          << " (expected avx512, avx2, neon, scalar, fp32, fp16 or int8)" << std::endl;
+                return nullptr;
+            }
+            start = end;
+        }
+        return std::unique_ptr<InferenceSession>(new MlpSession(kernel, precision));
+    }
+#ifdef LIMX_SDK_WITH_ONNXRUNTIME
+    if (backend == "onnxruntime") {
+        return std::unique_ptr<InferenceSession>(new OnnxRuntimeSession());
+    }
+#endif
+    std::cerr << "Inference backend not available: " << backend << std::endl;
+    return nullptr;
+}
+
+/**
+ * @brief Creates a session of @p backend and loads @p path into it.
+ */
+inline std::unique_ptr<InferenceSession> loadInferenceSession(const std::string& backend, const std::string& path) {
+    std::unique_ptr<InferenceSession> session = createInferenceSession(backend);
+    if (session && !session->load(path)) {
+        session.reset();
+    }
+    return session;
+}
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // SESSION_FACTORY_H
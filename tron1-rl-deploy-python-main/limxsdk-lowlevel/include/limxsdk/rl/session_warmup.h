@@ -0,0 +1,78 @@
+/**
+ * @file session_warmup.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef SESSION_WARMUP_H
+#define SESSION_WARMUP_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/inference_session.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @struct WarmupReport
+ * @brief Latencies of a session seen during warm-up.
+ */
+struct LIMX_SDK_API WarmupReport {
+    int runs = 0;                 // Calls including the first
+    int64_t firstNs = 0;          // The very first call, with lazy setup and cold caches
+    int64_t steadyMeanNs = 0;     // Mean over the second half of the calls
+    int64_t steadyMaxNs = 0;
+};
+
+/**
+ * @brief Runs @p session on @p iterations synthetic inputs before it is used for control.
+ *
+ * The inputs are standard normal values, the range of the normalized
+ * observations, so every kernel path and weight page is touched once. The
+ * session's own buffers are reused by each call; this only allocates the
+ * synthetic input and output.
+ * @return False if a call fails.
+ */
+inline bool warmUpSession(InferenceSession& session, int iterations, WarmupReport& report) {
+    std::mt19937 rng(1);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    std::vector<float> input(session.inputSize());
+    std::vector<float> output(session.outputSize());
+
+    report = WarmupReport();
+    iterations = std::max(iterations, 1);
+    int64_t steadySum = 0;
+    int steadyRuns = 0;
+    for (int i = 0; i < iterations; ++i) {
+        for (auto& v : input) {
+            v = normal(rng);
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (!session.run(input.data(), output.data())) {
+            return false;
+        }
+        const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        if (i == 0) {
+            report.firstNs = ns;
+        }
+        if (i >= iterations / 2) {
+            steadySum += ns;
+            steadyRuns++;
+            report.steadyMaxNs = std::max(report.steadyMaxNs, ns);
+        }
+        report.runs++;
+    }
+    report.steadyMeanNs = steadyRuns ? steadySum / steadyRuns : 0;
+    return true;
+}
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // SESSION_WARMUP_H
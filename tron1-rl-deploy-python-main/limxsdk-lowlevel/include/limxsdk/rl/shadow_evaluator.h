@@ -0,0 +1,240 @@
+/**
+ * @file shadow_evaluator.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef SHADOW_EVALUATOR_H
+#define SHADOW_EVALUATOR_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+#include "limxsdk/rl/batched_mlp.h"
+#include "limxsdk/rl/locomotion_controller.h"
+#include "limxsdk/rl/mlp_session.h"
+#include "limxsdk/rl/onnx_model.h"
+#include "limxsdk/rl/policy_config.h"
+
+namespace limxsdk {
+namespace rl {
+
+/**
+ * @struct ActionDeltaStats
+ * @brief Distribution of |candidate action - live action| over evaluated policy steps.
+ */
+struct LIMX_SDK_API ActionDeltaStats {
+    uint64_t steps = 0;
+    double sumAbs = 0.0;                 // Over all joints and steps
+    double sumSquares = 0.0;
+    double maxAbs = 0.0;
+    std::vector<double> jointSumAbs;     // Per policy output
+
+    void reset(size_t joints) {
+        steps = 0;
+        sumAbs = 0.0;
+        sumSquares = 0.0;
+        maxAbs = 0.0;
+        jointSumAbs.assign(joints, 0.0);
+    }
+
+    double mean() const { return steps ? sumAbs / (steps * jointSumAbs.size()) : 0.0; }
+    double rms() const { return steps ? std::sqrt(sumSquares / (steps * jointSumAbs.size())) : 0.0; }
+    double jointMean(size_t joint) const { return steps ? jointSumAbs[joint] / steps : 0.0; }
+};
+
+/**
+ * @class ShadowEvaluator
+ * @brief Runs candidate policies open loop next to the live one and compares their actions.
+ *
+ * evaluate() takes the observation history and policy input that the live
+ * LocomotionController built for its last inference, so candidates never
+ * build observations of their own. All encoders read that history and all
+ * policies read the same [observation, commands] after their own latent;
+ * BatchedMlp therefore evaluates the live networks and every candidate
+ * with one fused first-layer GEMV per stage. The live networks run again
+ * in fp32 inside the batch, so the deltas are measured against the fp32
+ * live policy on the same code path.
+ *
+ * Candidates only observe; their actions never reach the robot and the
+ * last_actions term they see is the live policy's. Each candidate must use
+ * the live observation layout and normalization.
+ */
+class LIMX_SDK_API ShadowEvaluator {
+public:
+    /**
+     * @brief Loads the fp32 copy of the live networks described by @p live.
+     */
+    bool init(const PolicyConfig& live, const std::string& kernel = "") {
+        kernel_ = kernel;
+        live_ = live;
+        candidates_.clear();
+        return addModel("live", live) && rebuild();
+    }
+
+    /**
+     * @brief Adds a candidate; it must observe exactly what the live policy observes.
+     */
+    bool addCandidate(const std::string& name, const PolicyConfig& candidate) {
+        if (!sameObservation(live_, candidate)) {
+            std::cerr << "Shadow " << name << ": observation layout or normalization differs from the live policy"
+                      << std::endl;
+            return false;
+        }
+        if (!addModel(name, candidate)) {
+            return false;
+        }
+        if (candidates_.back()->encoder.inputSize() != candidates_.front()->encoder.inputSize()) {
+            std::cerr << "Shadow " << name << ": encoder takes " << candidates_.back()->encoder.inputSize()
+                      << " inputs, the live one " << candidates_.front()->encoder.inputSize() << std::endl;
+            candidates_.pop_back();
+            return false;
+        }
+        return rebuild();
+    }
+
+    /**
+     * @brief Number of candidates, not counting the live policy.
+     */
+    size_t size() const { return candidates_.empty() ? 0 : candidates_.size() - 1; }
+    const std::string& name(size_t candidate) const { return candidates_[candidate + 1]->name; }
+    const ActionDeltaStats& stats(size_t candidate) const { return candidates_[candidate + 1]->stats; }
+
+    /**
+     * @brief Time of the last evaluate().
+     */
+    int64_t lastNs() const { return lastNs_; }
+
+    void resetStats() {
+        for (auto& c : candidates_) {
+            c->stats.reset(c->actions.size());
+        }
+    }
+
+    /**
+     * @brief Evaluates all candidates on the inputs of @p live's last inference and updates the statistics.
+     * @return False if @p live did not infer in its last update().
+     */
+    bool evaluate(const LocomotionController& live) {
+        if (!live.inferred() || live.encoderInputSize() != encoders_.sharedSize()) {
+            return false;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        encoders_.run(live.encoderInput(), nullptr, latentPointers_.data());
+        policies_.run(live.policyInput().data() + live.config().encoderOutputSize, latentConstPointers_.data(),
+                      actionPointers_.data());
+
+        for (auto& c : candidates_) {
+            for (auto& a : c->actions) {
+                a = std::max(-c->clipActions, std::min(c->clipActions, a));
+            }
+        }
+        const std::vector<float>& reference = candidates_.front()->actions;
+        for (size_t n = 1; n < candidates_.size(); ++n) {
+            Candidate& c = *candidates_[n];
+            for (size_t j = 0; j < reference.size(); ++j) {
+                const double delta = std::fabs(static_cast<double>(c.actions[j]) - reference[j]);
+                c.stats.sumAbs += delta;
+                c.stats.sumSquares += delta * delta;
+                c.stats.maxAbs = std::max(c.stats.maxAbs, delta);
+                c.stats.jointSumAbs[j] += delta;
+            }
+            c.stats.steps++;
+        }
+        lastNs_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        return true;
+    }
+
+private:
+    struct Candidate {
+        std::string name;
+        MlpNetwork encoder;
+        MlpNetwork policy;
+        std::vector<float> latent;
+        std::vector<float> actions;
+        float clipActions = 100.0f;
+        ActionDeltaStats stats;
+    };
+
+    bool addModel(const std::string& name, const PolicyConfig& config) {
+        candidates_.push_back(std::unique_ptr<Candidate>(new Candidate()));
+        Candidate& c = *candidates_.back();
+        c.name = name;
+        OnnxModel encoder;
+        OnnxModel policy;
+        if (!encoder.load(config.encoderPath) || !c.encoder.import(encoder, kernel_) ||
+            !policy.load(config.policyPath) || !c.policy.import(policy, kernel_)) {
+            std::cerr << "Shadow " << name << ": cannot load the networks into the native MLP engine" << std::endl;
+            candidates_.pop_back();
+            return false;
+        }
+        if (c.policy.outputSize() != static_cast<size_t>(config.jointCount()) ||
+            c.policy.inputSize() != c.encoder.outputSize() + config.observationsSize + config.policyCommandsSize()) {
+            std::cerr << "Shadow " << name << ": policy input or output size does not match params.yaml" << std::endl;
+            candidates_.pop_back();
+            return false;
+        }
+        c.latent.assign(c.encoder.outputSize(), 0.0f);
+        c.actions.assign(c.policy.outputSize(), 0.0f);
+        c.clipActions = config.clipActions;
+        c.stats.reset(c.actions.size());
+        return true;
+    }
+
+    // The batches reference the networks of candidates_ and are rebuilt when one is added
+    bool rebuild() {
+        std::vector<MlpNetwork*> encoders;
+        std::vector<MlpNetwork*> policies;
+        std::vector<int> encoderPrivate;
+        std::vector<int> policyPrivate;
+        latentPointers_.clear();
+        latentConstPointers_.clear();
+        actionPointers_.clear();
+        for (auto& c : candidates_) {
+            encoders.push_back(&c->encoder);
+            policies.push_back(&c->policy);
+            encoderPrivate.push_back(0);
+            policyPrivate.push_back(static_cast<int>(c->latent.size()));
+            latentPointers_.push_back(c->latent.data());
+            latentConstPointers_.push_back(c->latent.data());
+            actionPointers_.push_back(c->actions.data());
+        }
+        return encoders_.build(encoders, encoderPrivate) && policies_.build(policies, policyPrivate);
+    }
+
+    static bool sameObservation(const PolicyConfig& a, const PolicyConfig& b) {
+        for (int i = 0; i < 3; ++i) {
+            if (a.userCmdScales[i] != b.userCmdScales[i] || a.imuOrientationOffset[i] != b.imuOrientationOffset[i]) {
+                return false;
+            }
+        }
+        return a.jointNames == b.jointNames && a.rlType == b.rlType && a.observationTerms == b.observationTerms &&
+               a.observationsSize == b.observationsSize && a.policyCommandsSize() == b.policyCommandsSize() &&
+               a.jointPosIdxs == b.jointPosIdxs && a.defaultJointAngles == b.defaultJointAngles &&
+               a.angVelScale == b.angVelScale && a.dofPosScale == b.dofPosScale && a.dofVelScale == b.dofVelScale &&
+               a.clipObservations == b.clipObservations && a.gaitFrequency == b.gaitFrequency &&
+               a.gaitSwingHeight == b.gaitSwingHeight;
+    }
+
+    std::string kernel_;
+    PolicyConfig live_;
+    std::vector<std::unique_ptr<Candidate>> candidates_;   // Live policy first
+    BatchedMlp encoders_;
+    BatchedMlp policies_;
+    std::vector<float*> latentPointers_;
+    std::vector<const float*> latentConstPointers_;
+    std::vector<float*> actionPointers_;
+    int64_t lastNs_ = 0;
+};
+
+} // namespace rl
+} // namespace limxsdk
+
+#endif // SHADOW_EVALUATOR_H
@@ -0,0 +1,358 @@
+/**
+ * @file joint_trajectory.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef JOINT_TRAJECTORY_H
+#define JOINT_TRAJECTORY_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+
+namespace limxsdk {
+namespace trajectory {
+
+/**
+ * @brief Shape of a point-to-point joint move.
+ */
+enum class Profile {
+    LINEAR,             // Constant velocity, the blend the examples and Python controllers use
+    CUBIC,              // Cubic polynomial matching the start and goal velocities
+    QUINTIC,            // Quintic polynomial matching the start and goal velocities and accelerations
+    MIN_JERK,           // Quintic from rest to rest, the minimum-jerk move
+    TRAPEZOIDAL         // Constant acceleration, cruise, constant deceleration, from rest to rest
+};
+
+inline bool parseProfile(const std::string& name, Profile& profile) {
+    if (name == "linear") {
+        profile = Profile::LINEAR;
+    } else if (name == "cubic") {
+        profile = Profile::CUBIC;
+    } else if (name == "quintic") {
+        profile = Profile::QUINTIC;
+    } else if (name == "min_jerk") {
+        profile = Profile::MIN_JERK;
+    } else if (name == "trapezoidal") {
+        profile = Profile::TRAPEZOIDAL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @struct TrajectoryRequest
+ * @brief Move of every joint from start to goal; optional vectors are either empty or one value per joint.
+ */
+struct LIMX_SDK_API TrajectoryRequest {
+    Profile profile = Profile::MIN_JERK;
+    std::vector<float> start;
+    std::vector<float> goal;
+    std::vector<float> startVelocity;       // CUBIC and QUINTIC, empty for rest
+    std::vector<float> goalVelocity;
+    std::vector<float> startAcceleration;   // QUINTIC, empty for zero
+    std::vector<float> goalAcceleration;
+    std::vector<float> maxVelocity;         // Empty for unlimited; TRAPEZOIDAL needs both limits
+    std::vector<float> maxAcceleration;
+    double minDuration = 0.0;               // Seconds; the move takes longer only to respect the limits
+};
+
+/**
+ * @class JointTrajectory
+ * @brief Point-to-point move of several joints that start and finish together.
+ *
+ * plan() picks the shortest duration, at least minDuration, at which no
+ * joint exceeds its velocity or acceleration limit, then precomputes the
+ * coefficients of every joint for that common duration: polynomial
+ * coefficients in time for the polynomial profiles, and for TRAPEZOIDAL
+ * the cruise velocity at which each joint's own acceleration fits the
+ * common duration. evaluate() then costs a fixed number of operations per
+ * joint, whatever the time, and never allocates; plan() only allocates
+ * when the joint count grows.
+ *
+ * The limits of the polynomial profiles with boundary velocities are
+ * checked at 64 points of the move, and the duration is stretched until
+ * they hold; rest-to-rest moves use the exact peak values.
+ */
+class LIMX_SDK_API JointTrajectory {
+public:
+    static const int CHECK_POINTS = 64;
+
+    /**
+     * @return False if the request is inconsistent or cannot meet its limits; the trajectory is then empty.
+     */
+    bool plan(const TrajectoryRequest& request) {
+        const size_t n = request.start.size();
+        joints_ = 0;
+        duration_ = 0.0;
+        if (n == 0 || request.goal.size() != n || !optional(request.startVelocity, n) ||
+            !optional(request.goalVelocity, n) || !optional(request.startAcceleration, n) ||
+            !optional(request.goalAcceleration, n) || !optional(request.maxVelocity, n) ||
+            !optional(request.maxAcceleration, n)) {
+            std::cerr << "JointTrajectory: every per-joint vector needs " << n << " values or none" << std::endl;
+            return false;
+        }
+        for (size_t j = 0; j < n; ++j) {
+            if (limit(request.maxVelocity, j) <= 0.0f || limit(request.maxAcceleration, j) <= 0.0f) {
+                std::cerr << "JointTrajectory: limits must be positive (joint " << j << ")" << std::endl;
+                return false;
+            }
+            if (std::fabs(value(request.startVelocity, j)) > limit(request.maxVelocity, j) ||
+                std::fabs(value(request.goalVelocity, j)) > limit(request.maxVelocity, j) ||
+                std::fabs(value(request.startAcceleration, j)) > limit(request.maxAcceleration, j) ||
+                std::fabs(value(request.goalAcceleration, j)) > limit(request.maxAcceleration, j)) {
+                std::cerr << "JointTrajectory: boundary velocity or acceleration above the limit (joint " << j << ")"
+                          << std::endl;
+                return false;
+            }
+        }
+        if (request.profile == Profile::TRAPEZOIDAL &&
+            (request.maxVelocity.empty() || request.maxAcceleration.empty())) {
+            std::cerr << "JointTrajectory: trapezoidal profiles need velocity and acceleration limits" << std::endl;
+            return false;
+        }
+
+        profile_ = request.profile;
+        joints_ = n;
+        for (int k = 0; k < 6; ++k) {
+            c_[k].assign(n, 0.0f);
+        }
+        goal_.assign(request.goal.begin(), request.goal.end());
+        cruise_.assign(n, 0.0f);
+        accel_.assign(n, 0.0f);
+        rampTime_.assign(n, 0.0f);
+
+        double duration = std::max(request.minDuration, restToRestDuration(request));
+        if (profile_ == Profile::TRAPEZOIDAL) {
+            duration_ = duration;
+            planTrapezoid(request);
+            return true;
+        }
+        // Polynomials with boundary velocities: stretch until the sampled peaks fit
+        for (int attempt = 0; attempt < 32; ++attempt) {
+            duration_ = duration;
+            planPolynomials(request);
+            const double scale = peakRatio(request);
+            if (scale <= 1.0 + 1e-4) {
+                return true;
+            }
+            duration = std::max(duration * std::min(scale, 2.0), duration + 1e-6);
+        }
+        std::cerr << "JointTrajectory: limits not met after stretching the move to " << duration_ << " s"
+                  << std::endl;
+        joints_ = 0;
+        duration_ = 0.0;
+        return false;
+    }
+
+    double duration() const { return duration_; }
+    size_t size() const { return joints_; }
+    Profile profile() const { return profile_; }
+
+    /**
+     * @brief Joint positions, and optionally velocities and accelerations, @p t seconds into the move.
+     *
+     * Times outside [0, duration] are clamped to it.
+     */
+    void evaluate(double t, float* q, float* dq = nullptr, float* ddq = nullptr) const {
+        const float s = static_cast<float>(std::max(0.0, std::min(duration_, t)));
+        if (profile_ == Profile::TRAPEZOIDAL) {
+            evaluateTrapezoid(s, q, dq, ddq);
+            return;
+        }
+        const float* c0 = c_[0].data();
+        const float* c1 = c_[1].data();
+        const float* c2 = c_[2].data();
+        const float* c3 = c_[3].data();
+        const float* c4 = c_[4].data();
+        const float* c5 = c_[5].data();
+        for (size_t j = 0; j < joints_; ++j) {
+            q[j] = c0[j] + s * (c1[j] + s * (c2[j] + s * (c3[j] + s * (c4[j] + s * c5[j]))));
+        }
+        if (dq) {
+            for (size_t j = 0; j < joints_; ++j) {
+                dq[j] = c1[j] + s * (2.0f * c2[j] + s * (3.0f * c3[j] + s * (4.0f * c4[j] + s * 5.0f * c5[j])));
+            }
+        }
+        if (ddq) {
+            for (size_t j = 0; j < joints_; ++j) {
+                ddq[j] = 2.0f * c2[j] + s * (6.0f * c3[j] + s * (12.0f * c4[j] + s * 20.0f * c5[j]));
+            }
+        }
+    }
+
+private:
+    static bool optional(const std::vector<float>& v, size_t n) { return v.empty() || v.size() == n; }
+    static float value(const std::vector<float>& v, size_t j) { return v.empty() ? 0.0f : v[j]; }
+    static float limit(const std::vector<float>& v, size_t j) {
+        return v.empty() ? std::numeric_limits<float>::infinity() : v[j];
+    }
+
+    // Shortest common duration of the rest-to-rest move from the peak velocity and acceleration of each shape
+    double restToRestDuration(const TrajectoryRequest& r) const {
+        // Peak velocity and acceleration as multiples of distance / T and distance / T^2
+        double peakVelocity = 1.0;
+        double peakAcceleration = 0.0;
+        switch (r.profile) {
+        case Profile::LINEAR:
+            break;
+        case Profile::CUBIC:
+            peakVelocity = 1.5;
+            peakAcceleration = 6.0;
+            break;
+        case Profile::QUINTIC:
+        case Profile::MIN_JERK:
+            peakVelocity = 1.875;
+            peakAcceleration = 10.0 / std::sqrt(3.0);
+            break;
+        case Profile::TRAPEZOIDAL:
+            break;
+        }
+        double duration = 0.0;
+        for (size_t j = 0; j < r.start.size(); ++j) {
+            const double distance = std::fabs(r.goal[j] - r.start[j]);
+            const double v = limit(r.maxVelocity, j);
+            const double a = limit(r.maxAcceleration, j);
+            if (r.profile == Profile::TRAPEZOIDAL) {
+                // Triangle when the joint cannot reach its velocity limit
+                const double shortest = distance <= v * v / a ? 2.0 * std::sqrt(distance / a) : distance / v + v / a;
+                duration = std::max(duration, shortest);
+            } else {
+                duration = std::max(duration, peakVelocity * distance / v);
+                duration = std::max(duration, std::sqrt(peakAcceleration * distance / a));
+            }
+        }
+        return duration;
+    }
+
+    void planPolynomials(const TrajectoryRequest& r) {
+        const double T = duration_;
+        for (size_t j = 0; j < joints_; ++j) {
+            const double q0 = r.start[j];
+            const double h = r.goal[j] - q0;
+            double v0 = 0.0, v1 = 0.0, a0 = 0.0, a1 = 0.0;
+            if (profile_ == Profile::CUBIC || profile_ == Profile::QUINTIC) {
+                v0 = value(r.startVelocity, j);
+                v1 = value(r.goalVelocity, j);
+            }
+            if (profile_ == Profile::QUINTIC) {
+                a0 = value(r.startAcceleration, j);
+                a1 = value(r.goalAcceleration, j);
+            }
+            double c[6] = {q0, 0.0, 0.0, 0.0, 0.0, 0.0};
+            if (T <= 0.0) {
+                c[0] = r.goal[j];       // Nothing to move: hold the goal
+            } else if (profile_ == Profile::LINEAR) {
+                c[1] = h / T;
+            } else if (profile_ == Profile::CUBIC) {
+                c[1] = v0;
+                c[2] = (3.0 * h - (2.0 * v0 + v1) * T) / (T * T);
+                c[3] = (-2.0 * h + (v0 + v1) * T) / (T * T * T);
+            } else {
+                const double T2 = T * T;
+                c[1] = v0;
+                c[2] = 0.5 * a0;
+                c[3] = (20.0 * h - (8.0 * v1 + 12.0 * v0) * T - (3.0 * a0 - a1) * T2) / (2.0 * T2 * T);
+                c[4] = (-30.0 * h + (14.0 * v1 + 16.0 * v0) * T + (3.0 * a0 - 2.0 * a1) * T2) / (2.0 * T2 * T2);
+                c[5] = (12.0 * h - 6.0 * (v1 + v0) * T + (a1 - a0) * T2) / (2.0 * T2 * T2 * T);
+            }
+            for (int k = 0; k < 6; ++k) {
+                c_[k][j] = static_cast<float>(c[k]);
+            }
+        }
+    }
+
+    // Largest ratio of sampled peak to limit, as a duration factor: velocity scales with 1/T, acceleration 1/T^2
+    double peakRatio(const TrajectoryRequest& r) const {
+        if (r.maxVelocity.empty() && r.maxAcceleration.empty()) {
+            return 1.0;
+        }
+        double ratio = 0.0;
+        for (size_t j = 0; j < joints_; ++j) {
+            const double v = limit(r.maxVelocity, j);
+            const double a = limit(r.maxAcceleration, j);
+            for (int i = 0; i <= CHECK_POINTS; ++i) {
+                const double s = duration_ * i / CHECK_POINTS;
+                const double velocity = c_[1][j] + s * (2.0 * c_[2][j] + s * (3.0 * c_[3][j] +
+                                        s * (4.0 * c_[4][j] + s * 5.0 * c_[5][j])));
+                const double acceleration = 2.0 * c_[2][j] + s * (6.0 * c_[3][j] + s * (12.0 * c_[4][j] +
+                                            s * 20.0 * c_[5][j]));
+                ratio = std::max(ratio, std::fabs(velocity) / v);
+                ratio = std::max(ratio, std::sqrt(std::fabs(acceleration) / a));
+            }
+        }
+        return ratio;
+    }
+
+    void planTrapezoid(const TrajectoryRequest& r) {
+        const double T = duration_;
+        for (size_t j = 0; j < joints_; ++j) {
+            const double h = r.goal[j] - r.start[j];
+            const double distance = std::fabs(h);
+            const double a = r.maxAcceleration[j];
+            c_[0][j] = r.start[j];
+            if (distance == 0.0 || T <= 0.0) {
+                continue;
+            }
+            // Cruise velocity covering the distance in T with this joint's acceleration
+            const double disc = std::max(0.0, a * a * T * T - 4.0 * a * distance);
+            const double cruise = 0.5 * (a * T - std::sqrt(disc));
+            const float direction = h > 0.0 ? 1.0f : -1.0f;
+            cruise_[j] = direction * static_cast<float>(cruise);
+            accel_[j] = direction * static_cast<float>(a);
+            rampTime_[j] = static_cast<float>(cruise / a);
+        }
+    }
+
+    void evaluateTrapezoid(float s, float* q, float* dq, float* ddq) const {
+        const float T = static_cast<float>(duration_);
+        for (size_t j = 0; j < joints_; ++j) {
+            const float ramp = rampTime_[j];
+            const float a = accel_[j];
+            const float v = cruise_[j];
+            float position, velocity, acceleration;
+            if (s < ramp) {
+                position = c_[0][j] + 0.5f * a * s * s;
+                velocity = a * s;
+                acceleration = a;
+            } else if (s <= T - ramp) {
+                position = c_[0][j] + 0.5f * a * ramp * ramp + v * (s - ramp);
+                velocity = v;
+                acceleration = 0.0f;
+            } else {
+                const float left = T - s;
+                position = goal_[j] - 0.5f * a * left * left;
+                velocity = a * left;
+                acceleration = -a;
+            }
+            q[j] = position;
+            if (dq) {
+                dq[j] = velocity;
+            }
+            if (ddq) {
+                ddq[j] = acceleration;
+            }
+        }
+    }
+
+    Profile profile_ = Profile::MIN_JERK;
+    size_t joints_ = 0;
+    double duration_ = 0.0;
+    std::vector<float> c_[6];               // Polynomial coefficients in seconds; c_[0] is the start
+    std::vector<float> goal_;
+    std::vector<float> cruise_;             // TRAPEZOIDAL: signed cruise velocity,
+    std::vector<float> accel_;              // signed acceleration,
+    std::vector<float> rampTime_;           // and acceleration time of each joint
+};
+
+} // namespace trajectory
+} // namespace limxsdk
+
+#endif // JOINT_TRAJECTORY_H
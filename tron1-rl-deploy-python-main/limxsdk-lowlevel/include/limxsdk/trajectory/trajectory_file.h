@@ -0,0 +1,301 @@
+/**
+ * @file trajectory_file.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef TRAJECTORY_FILE_H
+#define TRAJECTORY_FILE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "limxsdk/macros.h"
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace limxsdk {
+namespace trajectory {
+
+/**
+ * Binary joint trajectory format (.ltrj, little endian).
+ *
+ * A TrajectoryFileHeader padded to HEADER_SIZE bytes is followed by
+ * keyframe_count keyframes of stride bytes each:
+ *   uint64 time         nanoseconds, strictly increasing
+ *   float  q[joints]    joint positions
+ *   float  dq[joints]   joint velocities, only with TRAJECTORY_HAS_VELOCITY
+ * padded to a multiple of 8. The fixed stride lets a reader address any
+ * keyframe directly in the mapped file, so nothing is parsed at playback.
+ */
+enum TrajectoryFileFlags : uint32_t {
+    TRAJECTORY_HAS_VELOCITY = 1,
+};
+
+struct LIMX_SDK_API TrajectoryFileHeader {
+    enum : uint32_t { MAGIC = 0x4A52544C, VERSION = 1, HEADER_SIZE = 64, MAX_JOINTS = 4096 };  // "LTRJ"
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t joints;
+    uint32_t flags;             // TrajectoryFileFlags
+    uint32_t stride;            // Bytes per keyframe
+    uint32_t reserved;
+    uint64_t keyframe_count;
+    uint64_t first_time;        // Time of the first keyframe
+    uint64_t last_time;         // Time of the last keyframe
+
+    // 64-bit, so the joint count of a crafted header cannot wrap it around
+    static uint64_t strideFor(uint64_t joints, bool velocity) {
+        return (8u + 4u * joints * (velocity ? 2u : 1u) + 7u) & ~uint64_t(7);
+    }
+};
+
+/**
+ * @class TrajectoryFileWriter
+ * @brief Appends keyframes to a .ltrj file; the header is completed by close().
+ */
+class LIMX_SDK_API TrajectoryFileWriter {
+public:
+    ~TrajectoryFileWriter() { close(); }
+
+    bool open(const std::string& path, uint32_t joints, bool velocity) {
+        close();
+        out_.open(path, std::ios::binary | std::ios::trunc);
+        if (!out_ || joints == 0 || joints > TrajectoryFileHeader::MAX_JOINTS) {
+            std::cerr << "Failed to create trajectory file: " << path << std::endl;
+            out_.close();
+            return false;
+        }
+        std::memset(&header_, 0, sizeof(header_));
+        header_.magic = TrajectoryFileHeader::MAGIC;
+        header_.version = TrajectoryFileHeader::VERSION;
+        header_.joints = joints;
+        header_.flags = velocity ? static_cast<uint32_t>(TRAJECTORY_HAS_VELOCITY) : 0u;
+        header_.stride = static_cast<uint32_t>(TrajectoryFileHeader::strideFor(joints, velocity));
+        record_.assign(header_.stride, 0);
+        writeHeader();
+        return static_cast<bool>(out_);
+    }
+
+    /**
+     * @param dq Joint velocities; ignored, and may be null, for files without velocities.
+     * @return False if @p time does not follow the previous keyframe or the write failed.
+     */
+    bool append(uint64_t time, const float* q, const float* dq = nullptr) {
+        if (!out_.is_open() || (header_.keyframe_count > 0 && time <= header_.last_time) ||
+            ((header_.flags & TRAJECTORY_HAS_VELOCITY) && !dq)) {
+            return false;
+        }
+        uint8_t* p = record_.data();
+        std::memcpy(p, &time, sizeof(time));
+        std::memcpy(p + 8, q, sizeof(float) * header_.joints);
+        if (header_.flags & TRAJECTORY_HAS_VELOCITY) {
+            std::memcpy(p + 8 + sizeof(float) * header_.joints, dq, sizeof(float) * header_.joints);
+        }
+        out_.write(reinterpret_cast<const char*>(p), record_.size());
+        if (header_.keyframe_count == 0) {
+            header_.first_time = time;
+        }
+        header_.last_time = time;
+        header_.keyframe_count++;
+        return static_cast<bool>(out_);
+    }
+
+    uint64_t keyframeCount() const { return header_.keyframe_count; }
+
+    bool close() {
+        if (!out_.is_open()) {
+            return true;
+        }
+        out_.seekp(0);
+        writeHeader();
+        const bool ok = static_cast<bool>(out_);
+        out_.close();
+        return ok;
+    }
+
+private:
+    void writeHeader() {
+        char block[TrajectoryFileHeader::HEADER_SIZE] = {};
+        std::memcpy(block, &header_, sizeof(header_));
+        out_.write(block, sizeof(block));
+    }
+
+    std::ofstream out_;
+    TrajectoryFileHeader header_ = TrajectoryFileHeader();
+    std::vector<uint8_t> record_;
+};
+
+/**
+ * @class TrajectoryFile
+ * @brief Maps a .ltrj file read-only and addresses its keyframes in place.
+ *
+ * Only the pages around the playhead need to be resident: prefetch() asks
+ * the kernel to read a window ahead asynchronously, so the control loop
+ * touches pages that are already cached instead of faulting on the disk.
+ * open() reads every keyframe time once to check that they increase, so it
+ * belongs before the control loop. On Windows the file is read into memory
+ * instead.
+ */
+class LIMX_SDK_API TrajectoryFile {
+public:
+    TrajectoryFile() : data_(nullptr), size_(0) {}
+    ~TrajectoryFile() { close(); }
+
+    TrajectoryFile(const TrajectoryFile&) = delete;
+    TrajectoryFile& operator=(const TrajectoryFile&) = delete;
+
+    bool open(const std::string& path) {
+        close();
+#ifdef _WIN32
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            std::cerr << "Failed to open trajectory file: " << path << std::endl;
+            return false;
+        }
+        buffer_.resize(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cerr << "Failed to open trajectory file: " << path << std::endl;
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(TrajectoryFileHeader::HEADER_SIZE)) {
+            ::close(fd);
+            std::cerr << "Not a trajectory file: " << path << std::endl;
+            return false;
+        }
+        void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED) {
+            std::cerr << "Failed to map trajectory file: " << path << std::endl;
+            return false;
+        }
+        data_ = static_cast<const uint8_t*>(addr);
+        size_ = static_cast<size_t>(st.st_size);
+#endif
+        if (!valid()) {
+            std::cerr << "Not a trajectory file, or truncated: " << path << std::endl;
+            close();
+            return false;
+        }
+        path_ = path;
+        return true;
+    }
+
+    void close() {
+#ifndef _WIN32
+        if (data_) {
+            munmap(const_cast<uint8_t*>(data_), size_);
+        }
+#endif
+        buffer_.clear();
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    bool isOpen() const { return data_ != nullptr; }
+    const std::string& path() const { return path_; }
+    const TrajectoryFileHeader& header() const { return *reinterpret_cast<const TrajectoryFileHeader*>(data_); }
+
+    size_t joints() const { return header().joints; }
+    size_t size() const { return static_cast<size_t>(header().keyframe_count); }
+    bool hasVelocity() const { return (header().flags & TRAJECTORY_HAS_VELOCITY) != 0; }
+
+    uint64_t time(size_t i) const {
+        uint64_t t;
+        std::memcpy(&t, keyframe(i), sizeof(t));
+        return t;
+    }
+    // Keyframes are 8-byte aligned, so their floats can be read in place
+    const float* q(size_t i) const { return reinterpret_cast<const float*>(keyframe(i) + 8); }
+    const float* dq(size_t i) const { return q(i) + header().joints; }
+
+    /**
+     * @brief Index of the last keyframe at or before @p time, 0 before the first one; O(log n).
+     */
+    size_t find(uint64_t time) const {
+        size_t low = 0;
+        size_t high = size();
+        while (high - low > 1) {
+            const size_t mid = low + (high - low) / 2;
+            if (this->time(mid) <= time) {
+                low = mid;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    /**
+     * @brief Starts reading @p bytes of keyframes from keyframe @p first in the background.
+     */
+    void prefetch(size_t first, size_t bytes) const {
+#ifndef _WIN32
+        const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t begin = offset(std::min(first, size())) & ~(page - 1);
+        const size_t end = std::min(size_, offset(std::min(first, size())) + bytes);
+        if (end > begin) {
+            madvise(const_cast<uint8_t*>(data_) + begin, end - begin, MADV_WILLNEED);
+        }
+#else
+        (void)first;
+        (void)bytes;
+#endif
+    }
+
+private:
+    bool valid() const {
+        if (size_ < TrajectoryFileHeader::HEADER_SIZE) {
+            return false;
+        }
+        const TrajectoryFileHeader& h = header();
+        if (h.magic != TrajectoryFileHeader::MAGIC || h.version != TrajectoryFileHeader::VERSION || h.joints == 0 ||
+            h.joints > TrajectoryFileHeader::MAX_JOINTS || h.keyframe_count == 0 ||
+            h.stride != TrajectoryFileHeader::strideFor(h.joints, hasVelocity()) ||
+            h.keyframe_count > (size_ - TrajectoryFileHeader::HEADER_SIZE) / h.stride) {
+            return false;
+        }
+        if (time(0) != h.first_time || time(size() - 1) != h.last_time) {
+            return false;
+        }
+        // Playback divides by keyframe intervals and binary searches the times
+        for (size_t i = 1; i < size(); ++i) {
+            if (time(i) <= time(i - 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t offset(size_t i) const { return TrajectoryFileHeader::HEADER_SIZE + i * header().stride; }
+    const uint8_t* keyframe(size_t i) const { return data_ + offset(i); }
+
+    const uint8_t* data_;
+    size_t size_;
+    std::vector<uint8_t> buffer_;
+    std::string path_;
+};
+
+} // namespace trajectory
+} // namespace limxsdk
+
+#endif // TRAJECTORY_FILE_H
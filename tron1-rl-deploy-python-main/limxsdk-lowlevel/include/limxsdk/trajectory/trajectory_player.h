@@ -0,0 +1,223 @@
+/**
+ * @file trajectory_player.h
+ *
+ * © [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+ */
+
+#ifndef TRAJECTORY_PLAYER_H
+#define TRAJECTORY_PLAYER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include "limxsdk/macros.h"
+#include "limxsdk/trajectory/trajectory_file.h"
+
+namespace limxsdk {
+namespace trajectory {
+
+/**
+ * @class TrajectoryPlayer
+ * @brief Plays a mapped .ltrj trajectory at the control rate.
+ *
+ * The control thread calls advance() once per tick and sample() for the
+ * joint targets of the playhead. Between keyframes the positions are
+ * interpolated with cubic Hermite splines when the file has velocities and
+ * linearly otherwise; the velocity targets are the derivative of that
+ * curve scaled by the playback rate, and zero while paused or stopped at
+ * either end. The playhead keeps its keyframe index, so a tick moves it by
+ * a few keyframes at most and costs O(joints); only a seek searches the
+ * file. A window of prefetchBytes ahead of the playhead, in the playback
+ * direction, is requested from the kernel whenever the playhead has used
+ * half of the previous one.
+ *
+ * pause(), resume(), seek(), setRate() and pauseRequested() may be called
+ * from any thread; the requests take effect at the next advance(). The
+ * other accessors describe the playhead and belong to the control thread.
+ */
+class LIMX_SDK_API TrajectoryPlayer {
+public:
+    static const size_t DEFAULT_PREFETCH_BYTES = 1 << 20;
+    static constexpr double MAX_RATE = 4.0;
+
+    TrajectoryPlayer() : pauseRequest_(false), rateRequest_(1.0), seekRequest_(NO_SEEK) {}
+
+    bool open(const std::string& path, size_t prefetchBytes = DEFAULT_PREFETCH_BYTES) {
+        if (!file_.open(path)) {
+            return false;
+        }
+        prefetchBytes_ = std::max<size_t>(prefetchBytes, file_.header().stride);
+        prefetchKeyframes_ = std::max<size_t>(2, prefetchBytes_ / file_.header().stride);
+        duration_ = seconds(file_.size() - 1);
+        time_ = 0.0;
+        cursor_ = 0;
+        rate_ = 1.0;
+        paused_ = false;
+        pauseRequest_.store(false);
+        rateRequest_.store(1.0);
+        seekRequest_.store(NO_SEEK);
+        file_.prefetch(0, prefetchBytes_);
+        prefetched_ = 0;
+        return true;
+    }
+
+    bool isOpen() const { return file_.isOpen(); }
+    size_t joints() const { return file_.joints(); }
+    size_t keyframes() const { return file_.size(); }
+    const TrajectoryFile& file() const { return file_; }
+
+    double duration() const { return duration_; }
+    double time() const { return time_; }
+    double rate() const { return rate_; }
+    bool paused() const { return paused_; }
+
+    /**
+     * @brief True when the playhead rests at the end it is moving towards.
+     */
+    bool finished() const { return (rate_ > 0.0 && time_ >= duration_) || (rate_ < 0.0 && time_ <= 0.0); }
+
+    void pause() { pauseRequest_.store(true); }
+    void resume() { pauseRequest_.store(false); }
+
+    /**
+     * @brief Pause state as last requested, which paused() follows from the next advance().
+     */
+    bool pauseRequested() const { return pauseRequest_.load(); }
+
+    /**
+     * @brief Moves the playhead to @p seconds from the first keyframe, clamped to the trajectory.
+     */
+    void seek(double seconds) {
+        const double clamped = std::max(0.0, std::min(duration_, seconds));
+        seekRequest_.store(static_cast<int64_t>(clamped * 1e9 + 0.5));
+    }
+
+    /**
+     * @brief Sets the playback speed; 1 is real time, negative values play backwards.
+     */
+    void setRate(double rate) {
+        const double limit = MAX_RATE;
+        if (std::isfinite(rate)) {
+            rateRequest_.store(std::max(-limit, std::min(limit, rate)));
+        }
+    }
+
+    /**
+     * @brief Applies pending requests and moves the playhead by @p dt seconds of control time.
+     */
+    void advance(double dt) {
+        const int64_t seek = seekRequest_.exchange(NO_SEEK);
+        if (seek != NO_SEEK) {
+            time_ = std::min(duration_, seek * 1e-9);
+            cursor_ = file_.find(file_.header().first_time + static_cast<uint64_t>(seek));
+            prefetch(true);
+        }
+        rate_ = rateRequest_.load();
+        paused_ = pauseRequest_.load();
+        if (!paused_) {
+            time_ = std::max(0.0, std::min(duration_, time_ + dt * rate_));
+        }
+
+        const size_t last = file_.size() - 1;
+        while (cursor_ < last && seconds(cursor_ + 1) <= time_) {
+            ++cursor_;
+        }
+        while (cursor_ > 0 && seconds(cursor_) > time_) {
+            --cursor_;
+        }
+        prefetch(false);
+    }
+
+    /**
+     * @brief Joint position targets @p q and, if not null, velocity targets @p dq at the playhead.
+     */
+    void sample(float* q, float* dq = nullptr) const {
+        const size_t n = file_.joints();
+        const float* q0 = file_.q(cursor_);
+        if (cursor_ + 1 >= file_.size()) {
+            std::copy(q0, q0 + n, q);
+            if (dq) {
+                std::fill(dq, dq + n, 0.0f);
+            }
+            return;
+        }
+        const float* q1 = file_.q(cursor_ + 1);
+        const double start = seconds(cursor_);
+        const float h = static_cast<float>(seconds(cursor_ + 1) - start);
+        const float u = std::max(0.0f, std::min(1.0f, static_cast<float>(time_ - start) / h));
+        const bool moving = !paused_ && !finished();
+        const float scale = moving ? static_cast<float>(rate_) : 0.0f;
+
+        if (!file_.hasVelocity()) {
+            for (size_t j = 0; j < n; ++j) {
+                const float delta = q1[j] - q0[j];
+                q[j] = q0[j] + u * delta;
+                if (dq) {
+                    dq[j] = scale * delta / h;
+                }
+            }
+            return;
+        }
+
+        // Cubic Hermite basis and its derivative with respect to u
+        const float u2 = u * u;
+        const float u3 = u2 * u;
+        const float h00 = 2.0f * u3 - 3.0f * u2 + 1.0f;
+        const float h10 = u3 - 2.0f * u2 + u;
+        const float h01 = 3.0f * u2 - 2.0f * u3;
+        const float h11 = u3 - u2;
+        const float d00 = 6.0f * (u2 - u);
+        const float d10 = 3.0f * u2 - 4.0f * u + 1.0f;
+        const float d11 = 3.0f * u2 - 2.0f * u;
+        const float* v0 = file_.dq(cursor_);
+        const float* v1 = file_.dq(cursor_ + 1);
+        for (size_t j = 0; j < n; ++j) {
+            q[j] = h00 * q0[j] + h10 * h * v0[j] + h01 * q1[j] + h11 * h * v1[j];
+            if (dq) {
+                dq[j] = scale * (d00 * (q0[j] - q1[j]) / h + d10 * v0[j] + d11 * v1[j]);
+            }
+        }
+    }
+
+private:
+    static const int64_t NO_SEEK = -1;
+
+    double seconds(size_t i) const { return (file_.time(i) - file_.header().first_time) * 1e-9; }
+
+    // Requests the window ahead of the playhead once half of the previous one has been played
+    void prefetch(bool force) {
+        const size_t half = prefetchKeyframes_ / 2;
+        const size_t distance = cursor_ > prefetched_ ? cursor_ - prefetched_ : prefetched_ - cursor_;
+        if (!force && distance < half) {
+            return;
+        }
+        if (rate_ < 0.0) {
+            const size_t first = cursor_ > prefetchKeyframes_ ? cursor_ - prefetchKeyframes_ : 0;
+            file_.prefetch(first, (cursor_ - first + 1) * file_.header().stride);
+        } else {
+            file_.prefetch(cursor_, prefetchBytes_);
+        }
+        prefetched_ = cursor_;
+    }
+
+    TrajectoryFile file_;
+    size_t prefetchBytes_ = DEFAULT_PREFETCH_BYTES;
+    size_t prefetchKeyframes_ = 2;
+    size_t prefetched_ = 0;      // Keyframe at which the last window was requested
+    size_t cursor_ = 0;          // Last keyframe at or before the playhead
+    double duration_ = 0.0;
+    double time_ = 0.0;          // Playhead, seconds from the first keyframe
+    double rate_ = 1.0;
+    bool paused_ = false;
+
+    std::atomic<bool> pauseRequest_;
+    std::atomic<double> rateRequest_;
+    std::atomic<int64_t> seekRequest_;
+};
+
+} // namespace trajectory
+} // namespace limxsdk
+
+#endif // TRAJECTORY_PLAYER_H
@@ -0,0 +1,55 @@
+"""
+@file load_columns.py
+
+Loads .lfc files written by the flight_log_export tool into numpy arrays.
+
+Usage:
+    python3 load_columns.py session_state.lfc
+
+© [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+"""
+
+import struct
+import sys
+import zlib
+import numpy as np
+
+DTYPES = {0: np.uint64, 1: np.float32}
+
+def load_columns(path, columns=None):
+    """Returns {column name: array of shape (rows, width)}; only the named columns are inflated."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"LIMXCOL1" or data[-8:] != b"LIMXCEND":
+        raise ValueError("Not a columnar flight log export: " + path)
+
+    column_count, _chunk_rows = struct.unpack_from("<II", data, 8)
+    descriptors = []
+    offset = 16
+    for _ in range(column_count):
+        name, dtype, width = struct.unpack_from("<48sII", data, offset)
+        descriptors.append((name.split(b"\0", 1)[0].decode(), DTYPES[dtype], width))
+        offset += 56
+
+    (chunk_count,) = struct.unpack_from("<Q", data, len(data) - 16)
+    chunk_offsets = struct.unpack_from("<%dQ" % chunk_count, data, len(data) - 16 - 8 * chunk_count)
+
+    parts = {name: [] for name, _, _ in descriptors}
+    for chunk in chunk_offsets:
+        (rows,) = struct.unpack_from("<I", data, chunk)
+        offset = chunk + 4
+        for name, dtype, width in descriptors:
+            raw, packed = struct.unpack_from("<II", data, offset)
+            offset += 8
+            if columns is None or name in columns:
+                planes = np.frombuffer(zlib.decompress(data[offset:offset + packed]), np.uint8)
+                element = np.dtype(dtype).itemsize
+                values = planes.reshape(element, -1).T.copy().view(dtype)
+                parts[name].append(values.reshape(rows, width))
+            offset += packed
+
+    return {name: np.concatenate(chunks) for name, chunks in parts.items() if chunks}
+
+if __name__ == "__main__":
+    for name, array in load_columns(sys.argv[1]).items():
+        print(name, array.shape, array.dtype)
@@ -0,0 +1,45 @@
+"""
+@file export_reference.py
+
+Runs ONNX models through ONNX Runtime on random inputs and stores inputs and
+outputs as <model>.onnx.ref next to the model. rl_mlp_benchmark loads that
+file automatically and checks every native MLP kernel against it.
+
+Usage:
+    python3 export_reference.py controllers/model/PF_TRON1A/policy/isaacgym/policy.onnx [--count 1000]
+
+© [2025] LimX Dynamics Technology Co., Ltd. All rights reserved.
+"""
+
+import argparse
+import struct
+import numpy as np
+import onnxruntime as ort
+
+MAGIC = 0x4645524C  # "LREF"
+VERSION = 1
+
+def export(model, count, scale, seed):
+    session = ort.InferenceSession(model, providers=["CPUExecutionProvider"])
+    input_info = session.get_inputs()[0]
+    size = int(np.prod([d if isinstance(d, int) and d > 0 else 1 for d in input_info.shape]))
+    rng = np.random.default_rng(seed)
+    inputs = (rng.standard_normal((count, size)) * scale).astype(np.float32)
+    outputs = np.stack([session.run(None, {input_info.name: x})[0].reshape(-1) for x in inputs]).astype(np.float32)
+
+    path = model + ".ref"
+    with open(path, "wb") as f:
+        f.write(struct.pack("<IIIII", MAGIC, VERSION, count, size, outputs.shape[1]))
+        f.write(inputs.tobytes())
+        f.write(outputs.tobytes())
+    print(f"{path}: {count} samples, {size} -> {outputs.shape[1]}")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("models", nargs="+")
+    parser.add_argument("--count", type=int, default=1000)
+    parser.add_argument("--scale", type=float, default=1.0, help="standard deviation of the random inputs")
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+    for model in args.models:
+        export(model, args.count, args.scale, args.seed)